@@ -44,7 +44,7 @@ static_assert(fibonacci_v<8> == 21, "Fibonacci<8> должен быть 21");
 static_assert(fibonacci_v<9> == 34, "Fibonacci<9> должен быть 34");
 
 int main() {
-    // Можно вывести для проверки на этапе выполнения
+    // Проверка и на этапе выполнения: код возврата 0, если значение равно 55
     constexpr int fib10 = fibonacci_v<10>;
-    return fib10; // значение равно 55
+    return fib10 == 55 ? 0 : 1;
 }
@@ -1,100 +1,13 @@
+#include "Tuple.hpp"
+
 #include <cassert>
-#include <cstddef>
+#include <cstdint>
 #include <string>
+#include <type_traits>
 #include <utility>
 
 //////////////////////////////////////////////////////////////////
 
-// Базовый шаблон для пустого кортежа
-template <typename... Ts> 
-class Tuple 
-{
-public:
-    // Конструктор по умолчанию
-    Tuple() = default;
-    
-    // Функция для получения размера кортежа
-    constexpr std::size_t size() const noexcept
-    {
-        return sizeof...(Ts);
-    }
-};
-
-//////////////////////////////////////////////////////////////////
-
-// Вспомогательный шаблон для доступа к элементам
-template <std::size_t I, typename TupleType>
-struct TupleGetHelper;
-
-// Специализация для пустого кортежа
-template <std::size_t I>
-struct TupleGetHelper<I, Tuple<>>
-{
-    // Пустой кортеж не имеет элементов
-    static_assert(I == I, "Index out of bounds for empty tuple");
-};
-
-//////////////////////////////////////////////////////////////////
-
-// Специализация для непустого кортежа
-template <typename T, typename... Ts> 
-class Tuple<T, Ts...>
-{
-private:
-    T m_head;                // Головной элемент
-    Tuple<Ts...> m_tail;     // Хвост кортежа
-
-public:
-    // Конструктор с perfect forwarding
-    Tuple(T&& x, Ts&&... ys)
-        : m_head(std::forward<T>(x)),
-          m_tail(std::forward<Ts>(ys)...)
-    {}
-
-    // Функция для получения элемента по индексу
-    template <std::size_t I> 
-    auto get() const
-    {
-        return TupleGetHelper<I, Tuple<T, Ts...>>::get(*this);
-    }
-
-    // Функция для получения размера кортежа
-    constexpr std::size_t size() const noexcept
-    {
-        return sizeof...(Ts) + 1;
-    }
-
-    // Объявляем вспомогательный класс дружественным для доступа к приватным членам
-    template <std::size_t I2, typename TupleType>
-    friend struct TupleGetHelper;
-};
-
-//////////////////////////////////////////////////////////////////
-
-// Специализация для индекса 0
-template <typename T, typename... Ts>
-struct TupleGetHelper<0, Tuple<T, Ts...>>
-{
-    static auto get(const Tuple<T, Ts...>& tuple)
-    {
-        return tuple.m_head;
-    }
-};
-
-// Специализация для индекса > 0
-template <std::size_t I, typename T, typename... Ts>
-struct TupleGetHelper<I, Tuple<T, Ts...>>
-{
-    static auto get(const Tuple<T, Ts...>& tuple)
-    {
-        static_assert(I > 0, "Index must be positive for recursive case");
-        static_assert(I < sizeof...(Ts) + 1, "Index out of bounds");
-        return TupleGetHelper<I - 1, Tuple<Ts...>>::get(tuple.m_tail);
-    }
-};
-
-//////////////////////////////////////////////////////////////////
-
 // Тест 1: Пустой кортеж
 void test_empty_tuple()
 {
@@ -188,6 +101,64 @@ void test_nested_tuple()
     assert(nested_tuple.get<1>().get<1>() == 'A');
 }
 
+// Тест 11: Раскладка без выравнивания между полями
+void test_tuple_layout()
+{
+    static_assert(sizeof(Tuple<char, double, char>) == 16);
+    static_assert(sizeof(Tuple<char, std::int64_t, short, std::int32_t, char>) == 16);
+
+    Tuple<char, double, char> tuple('a', 1.5, 'b');
+    assert(tuple.get<0>() == 'a');
+    assert(tuple.get<1>() == 1.5);
+    assert(tuple.get<2>() == 'b');
+}
+
+// Тест 12: Отображение логических индексов в физические слоты
+void test_layout_slots()
+{
+    using L = Layout<Deque<char, double, short, int>>;
+
+    static_assert(std::is_same_v<L::physical, Deque<double, int, short, char>>);
+    static_assert(L::slot[0] == 3 && L::slot[1] == 0 && L::slot[2] == 2 && L::slot[3] == 1);
+    static_assert(L::naive_size == 24);
+    static_assert(sizeof(L::storage) == 16);
+
+    Packed<Deque<char, double, short, int>> packed('x', 2.5, short(7), 42);
+    assert(packed.get<0>() == 'x');
+    assert(packed.get<1>() == 2.5);
+    assert(packed.get<2>() == 7);
+    assert(packed.get<3>() == 42);
+
+    packed.get<3>() = 43;
+    assert(packed.get<3>() == 43);
+}
+
+// Тест 13: Запись с именованными полями
+struct Alive { using type = bool; };
+struct Id    { using type = std::int64_t; };
+struct Level { using type = std::int16_t; };
+struct Score { using type = std::int32_t; };
+struct Name  { using type = std::string; };
+
+void test_record()
+{
+    using Unit = Record<Alive, Id, Level, Score, Name>;
+
+    static_assert(Record<Alive, Id, Level, Score>::naive_size == 24);
+    static_assert(sizeof(Record<Alive, Id, Level, Score>) == 16);
+
+    Unit unit(true, 7, 3, 100, "Hero");
+    assert(unit.get<Alive>());
+    assert(unit.get<Id>() == 7);
+    assert(unit.get<Level>() == 3);
+    assert(unit.get<Score>() == 100);
+    assert(unit.get<Name>() == "Hero");
+
+    unit.get<Score>() += 5;
+    const Unit& cref = unit;
+    assert(cref.get<Score>() == 105);
+}
+
 //////////////////////////////////////////////////////////////////
 
 int main()
@@ -203,6 +174,9 @@ int main()
     test_const_tuple();
     test_move_tuple();
     test_nested_tuple();
+    test_tuple_layout();
+    test_layout_slots();
+    test_record();
     
     return 0;
 }
\ No newline at end of file
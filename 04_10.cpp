@@ -1,173 +1,63 @@
+#include "Deque.hpp"
+#include "Variant.hpp"
+
+#include <cassert>
 #include <cstddef>
+#include <cstdint>
+#include <string>
 #include <type_traits>
 
-template <typename... Ts>
-struct Deque {};
-
-template <typename D>
-struct Size {};
-
-template <typename... Ts>
-struct Size<Deque<Ts...>>
-{
-    static constexpr std::size_t value = sizeof...(Ts);
-};
-
-template <typename D>
-constexpr std::size_t size_v = Size<D>::value;
-
-template <typename D>
-constexpr bool is_empty_v = size_v<D> == 0;
-
-template <typename D>
-struct Front {};
-
-template <typename T, typename... Ts>
-struct Front<Deque<T, Ts...>>
-{
-    using type = T;
-};
-
-template <typename D>
-using front = typename Front<D>::type;
-
-template <typename T, typename D>
-struct Push_Front {};
-
-template <typename T, typename... Ts>
-struct Push_Front<T, Deque<Ts...>>
-{
-    using type = Deque<T, Ts...>;
-};
-
-template <typename T, typename D>
-using push_front = typename Push_Front<T, D>::type;
-
-template <typename D>
-struct Pop_Front {};
-
-template <typename T, typename... Ts>
-struct Pop_Front<Deque<T, Ts...>>
-{
-    using type = Deque<Ts...>;
-};
-
-template <typename D>
-using pop_front = typename Pop_Front<D>::type;
-
-template <typename D>
-struct Back {};
-
-template <typename T>
-struct Back<Deque<T>>
-{
-    using type = T;
-};
-
-template <typename T, typename... Ts>
-struct Back<Deque<T, Ts...>>
-{
-    using type = typename Back<Deque<Ts...>>::type;
-};
-
-template <typename D>
-using back = typename Back<D>::type;
-
-template <typename T, typename D, bool C = is_empty_v<D>>
-struct Push_Back {};
-
-template <typename T, typename D>
-struct Push_Back<T, D, false>
-{
-    using type =
-        push_front<
-            front<D>,
-            typename Push_Back<T, pop_front<D>>::type>;
-};
-
-template <typename T, typename D>
-struct Push_Back<T, D, true>
-{
-    using type = push_front<T, D>;
-};
-
-template <typename T, typename D>
-using push_back = typename Push_Back<T, D>::type;
-
-template <typename D>
-struct Pop_Back {};
-
-template <typename T>
-struct Pop_Back<Deque<T>>
-{
-    using type = Deque<>;
-};
-
-template <typename T, typename... Ts>
-struct Pop_Back<Deque<T, Ts...>>
-{
-    using type =
-        push_front<T, typename Pop_Back<Deque<Ts...>>::type>;
-};
-
-template <typename D>
-using pop_back = typename Pop_Back<D>::type;
-
-template <typename D, std::size_t I>
-struct Nth : Nth<pop_front<D>, I - 1> {};
-
-template <typename D>
-struct Nth<D, 0> : Front<D> {};
-
-template <typename D, std::size_t I>
-using nth = typename Nth<D, I>::type;
+struct Move   { int dx = 0; int dy = 0; };
+struct Attack { int target = 0; int damage = 0; };
+struct Chat   { std::string text; };
 
-template <typename D, bool C = is_empty_v<D>>
-struct Max_Type {};
+using Message = Variant<Move, Attack, Chat>;
 
-template <typename D>
-struct Max_Type<D, false>
+void test_variant()
 {
-private:
-    using current_t = front<D>;
-    using max_t = typename Max_Type<pop_front<D>>::type;
-
-public:
-    using type =
-        std::conditional_t<
-            (sizeof(current_t) >= sizeof(max_t)),
-            current_t,
-            max_t>;
-};
-
-template <typename D>
-struct Max_Type<D, true>
-{
-    using type = std::byte;
-};
-
-template <typename D>
-using max_type = typename Max_Type<D>::type;
-
-template <typename T, typename D, bool C = is_empty_v<D>>
-struct Has {};
-
-template <typename T, typename D>
-struct Has<T, D, true>
-{
-    static constexpr bool value = false;
-};
-
-template <typename T, typename D>
-struct Has<T, D, false>
-{
-    static constexpr bool value =
-        std::is_same_v<T, front<D>> ||
-        Has<T, pop_front<D>>::value;
-};
-
-template <typename T, typename D>
-constexpr bool has_v = Has<T, D>::value;
+    static_assert(std::is_same_v<Message::index_type, std::uint8_t>);
+    // Индексы 0..254 и npos = 255 — ещё uint8_t.
+    static_assert(std::is_same_v<variant_index_t<255>, std::uint8_t>);
+    static_assert(std::is_same_v<variant_index_t<256>, std::uint16_t>);
+    static_assert(sizeof(Variant<int, char>) == 2 * sizeof(int));
+    static_assert(std::is_trivially_copyable_v<Variant<int, double>>);
+    static_assert(!std::is_trivially_copyable_v<Message>);
+
+    Message m;
+    assert(m.index() == 0 && m.holds<Move>());
+
+    m = Attack{3, 25};
+    assert(m.index() == 1);
+    assert(m.get<Attack>().damage == 25);
+    assert(m.get_if<Chat>() == nullptr);
+
+    m = Chat{"hello"};
+    Message copy = m;
+    Message moved = std::move(copy);
+    assert(moved.get<Chat>().text == "hello");
+
+    moved = Move{1, 2};
+    assert(moved.holds<Move>());
+    moved = m;
+    assert(moved.get<Chat>().text == "hello");
+
+    int damage = 0;
+    std::string log;
+    auto handler = Overloaded{
+        [&](const Move& mv)   { log += "move " + std::to_string(mv.dx) + ";"; },
+        [&](const Attack& at) { damage += at.damage; log += "attack;"; },
+        [&](const Chat& c)    { log += "chat " + c.text + ";"; }};
+
+    Message inbox[] = {Move{1, 0}, Attack{1, 10}, Chat{"hi"}, Attack{2, 5}};
+    for (const auto& msg : inbox)
+        visit(handler, msg);
+
+    assert(damage == 15);
+    assert(log == "move 1;attack;chat hi;attack;");
+
+    auto size = m.visit([](const auto& value) { return sizeof(value); });
+    assert(size == sizeof(Chat));
+}
 
 int main()
 {
@@ -189,4 +79,33 @@ int main()
     static_assert(has_v<double, D2>);
     static_assert(has_v<char, D2>);
     static_assert(!has_v<float, D2>);
+
+    static_assert(std::is_same_v<push_back<char, D1>, Deque<int, char>>);
+    static_assert(std::is_same_v<push_front<char, D1>, Deque<char, int>>);
+    static_assert(std::is_same_v<pop_back<D2>, Deque<int, double>>);
+    static_assert(std::is_same_v<pop_back<D1>, D0>);
+    static_assert(std::is_same_v<pop_front<D2>, Deque<double, char>>);
+
+    static_assert(std::is_same_v<max_type<D0>, std::byte>);
+    static_assert(std::is_same_v<max_type<Deque<int, float, char>>, int>);
+
+    static_assert(index_of_v<int, D2> == 0);
+    static_assert(index_of_v<char, D2> == 2);
+    static_assert(index_of_v<float, D2> == size_v<D2>);
+    static_assert(index_of_v<int, D0> == 0);
+
+    static_assert(std::is_same_v<transform<std::add_pointer_t, D2>, Deque<int*, double*, char*>>);
+    static_assert(std::is_same_v<transform<std::add_pointer_t, D0>, D0>);
+
+    static_assert(std::is_same_v<filter<std::is_integral, D2>, Deque<int, char>>);
+    static_assert(std::is_same_v<filter<std::is_class, D2>, D0>);
+
+    static_assert(std::is_same_v<unique<Deque<int, char, int, double, char>>, Deque<int, char, double>>);
+    static_assert(std::is_same_v<unique<D0>, D0>);
+
+    static_assert(std::is_same_v<sort_by_size<Deque<double, char, int, short, float>>,
+                                 Deque<char, short, int, float, double>>);
+    static_assert(std::is_same_v<sort_by_size<D0>, D0>);
+
+    test_variant();
 }
\ No newline at end of file
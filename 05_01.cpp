@@ -1,63 +1,11 @@
+#include "Person.hpp"
+#include "PersonTable.hpp"
+
 #include <cassert>
 #include <string>
+#include <type_traits>
 #include <utility>
-
-class Builder;
-
-class Person
-{
-public:
-    Person() = default;
-
-    Person(std::string name, int age, int grade)
-        : m_name(std::move(name))
-        , m_age(age)
-        , m_grade(grade)
-    {}
-
-    const std::string& name() const { return m_name; }
-    int age()   const { return m_age; }
-    int grade() const { return m_grade; }
-
-private:
-    std::string m_name;
-    int m_age   = 0;
-    int m_grade = 0;
-
-    friend class Builder;
-};
-
-class Builder
-{
-public:
-    Builder() = default;
-
-    Builder& name(std::string name)
-    {
-        m_person.m_name = std::move(name);
-        return *this;
-    }
-
-    Builder& age(int age)
-    {
-        m_person.m_age = age;
-        return *this;
-    }
-
-    Builder& grade(int grade)
-    {
-        m_person.m_grade = grade;
-        return *this;
-    }
-
-    Person get() const
-    {
-        return m_person;
-    }
-
-private:
-    Person m_person;
-};
+#include <vector>
 
 int main()
 {
@@ -74,4 +22,50 @@ int main()
     assert(person.name()  == "Ivan");
     assert(person.age()   == 25);
     assert(person.grade() == 10);
-}
\ No newline at end of file
+
+    auto moved = Builder()
+        .name("Maria")
+        .age(30)
+        .grade(11)
+        .build();
+
+    assert(moved.name()  == "Maria");
+    assert(moved.age()   == 30);
+    assert(moved.grade() == 11);
+
+    std::vector<std::string> names = {"Anna", "Boris", "Vera"};
+    std::vector<int> ages   = {18, 19, 20};
+    std::vector<int> grades = {9, 10, 11};
+
+    std::vector<Person> people;
+    Builder::build_into(people, names, ages, grades);
+
+    assert(people.size() == 3);
+    assert(people[1].name()  == "Boris");
+    assert(people[1].age()   == 19);
+    assert(people[2].grade() == 11);
+
+    PersonTable table;
+    table.insert(people);
+    table.insert(person);
+    table.insert(std::vector<std::string>{"Gleb", "Dina"}, std::vector<int>{25, 40},
+                 std::vector<int>{11, 10});
+
+    assert(table.size() == 6);
+    assert(table.name(0) == "Anna");
+    assert(table.name(3) == "Ivan" && table.age(3) == 25 && table.grade(3) == 10);
+    assert(table.person(5).name() == "Dina");
+
+    auto adults = table.by_age(19, 25);
+    assert(adults.size() == 4);
+    assert(table.age(adults.front()) == 19 && table.age(adults.back()) == 25);
+
+    auto tenth = table.by_grade(10, 10);
+    assert(tenth.size() == 3);
+
+    assert(table.by_age(50, 60).empty());
+    assert(table.by_age(30, 20).empty());
+
+    auto rows = table.query(20, 40, 10, 10);
+    assert((rows == std::vector<PersonTable::Row>{3, 5}));
+}
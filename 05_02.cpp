@@ -1,47 +1,12 @@
+#include "Entity.hpp"
+
 #include <iostream>
+#include <memory>
 #include <string>
 #include <cassert>
-
-class Entity
-{
-public:
-    virtual ~Entity() = default;
-    virtual std::string name() const = 0;
-    virtual int value() const = 0;
-};
-
-class BaseEntity : public virtual Entity
-{
-public:
-    BaseEntity(std::string n, int v)
-        : m_name(std::move(n)), m_value(v) {}
-
-    std::string name() const override { return m_name; }
-    int value() const override { return m_value; }
-
-private:
-    std::string m_name;
-    int m_value = 0;
-};
-
-template <typename T>
-class Decorator : public virtual Entity, public T
-{
-public:
-    template <typename... Args>
-    Decorator(Args&&... args)
-        : T(std::forward<Args>(args)...) {}
-
-    std::string name() const override
-    {
-        return "Decorated(" + T::name() + ")";
-    }
-
-    int value() const override
-    {
-        return T::value() + 10;
-    }
-};
+#include <thread>
+#include <type_traits>
+#include <vector>
 
 int main()
 {
@@ -57,4 +22,39 @@ int main()
 
     std::cout << "Entity: " << entity.name() << " = " << entity.value() << "\n";
     std::cout << "Decorated: " << decorated.name() << " = " << decorated.value() << "\n";
-}
\ No newline at end of file
+
+    Decorator<Decorator<BaseEntity>> nested("Inner", 1);
+    std::string_view first = nested.name();
+    assert(first == "Decorated(Decorated(Inner))");
+    assert(nested.name().data() == first.data());
+
+    nested.rename("Renamed");
+    assert(nested.name() == "Decorated(Decorated(Renamed))");
+    assert(nested.value() == 21);
+
+    Decorator<Decorator<BaseEntity>> shared("Shared", 0);
+    std::vector<std::thread> readers;
+    std::vector<std::string_view> seen(8);
+    for (std::size_t i = 0; i < seen.size(); ++i)
+        readers.emplace_back([&, i] { seen[i] = shared.name(); });
+    for (auto& reader : readers)
+        reader.join();
+    for (auto view : seen)
+        assert(view.data() == seen.front().data() && view == "Decorated(Decorated(Shared))");
+
+    using Twice = StaticDecorator<StaticDecorator<StaticEntity>>;
+
+    static_assert(!std::is_polymorphic_v<Twice>);
+    static_assert(Twice::name_prefix.view() == "Decorated(Decorated(");
+    static_assert(Twice::name_suffix.view() == "))");
+
+    Twice twice("Test", 42);
+    assert(twice.name() == "Decorated(Decorated(Test))");
+    assert(twice.value() == 62);
+
+    std::unique_ptr<Entity> dynamic = std::make_unique<EntityAdapter<Twice>>("Test", 42);
+    assert(dynamic->name() == twice.name());
+    assert(dynamic->value() == 62);
+
+    std::cout << "Static: " << twice.name() << " = " << twice.value() << "\n";
+}
@@ -1,139 +1,219 @@
+#include "AttackBehavior.hpp"
+#include "Combat.hpp"
+#include "GameUnit.hpp"
+#include "ParallelAttack.hpp"
+#include "ThreadPool.hpp"
+#include "World.hpp"
+
 #include <iostream>
 #include <memory>
+#include <sstream>
 #include <string>
+#include <thread>
 #include <vector>
 #include <cassert>
+#include <climits>
 
-class Character
+int main()
 {
-public:
-    std::string name;
-    int health = 100;
-    int attackPower = 10;
+    CharacterBuilder builder;
+    auto hero = builder.setName("Hero").setHealth(150).setAttack(25).get();
+    auto mage = builder.setName("Mage").setHealth(100).setAttack(40).get();
+    auto archer = CharacterBuilder().setName("Archer").setHealth(80).setAttack(30).build();
 
-    void info() const
-    {
-        std::cout << "Character: " << name 
-                  << " [HP=" << health 
-                  << ", ATK=" << attackPower << "]\n";
-    }
-};
+    assert(hero.name == "Hero" && mage.name == "Mage");
+    assert(archer.name == "Archer" && archer.health == 80 && archer.attackPower == 30);
 
-class CharacterBuilder
-{
-public:
-    CharacterBuilder& setName(const std::string& n) { m_character.name = n; return *this; }
-    CharacterBuilder& setHealth(int h) { m_character.health = h; return *this; }
-    CharacterBuilder& setAttack(int a) { m_character.attackPower = a; return *this; }
+    auto heroUnit = std::make_shared<SingleUnit>(hero);
+    auto mageUnit = std::make_shared<SingleUnit>(mage);
 
-    Character get() { return m_character; }
+    auto party = std::make_shared<UnitGroup>();
+    party->addUnit(heroUnit);
+    party->addUnit(mageUnit);
 
-private:
-    Character m_character;
-};
+    party->info();
+    party->attack();
 
-class GameUnit
-{
-public:
-    virtual ~GameUnit() = default;
-    virtual void info(int indent = 0) const = 0;
-    virtual void attack() = 0;
-};
+    SwordAttack sword;
+    MagicAttack magic;
 
-using GameUnitPtr = std::shared_ptr<GameUnit>;
+    std::cout << "\nHero attacks:\n";
+    sword.performAttack();
 
-class SingleUnit : public GameUnit
-{
-public:
-    SingleUnit(Character c) : m_character(std::move(c)) {}
+    std::cout << "\nMage attacks:\n";
+    magic.performAttack();
 
-    void info(int indent = 0) const override
+    // Конвейер политик: три фазы без виртуальных вызовов, записи — в приёмник.
+    RingBuffer<AttackRecord, 8> ring;
+    RingSink<8> ringSink(ring);
+    SwordPipeline::perform(ringSink);
+    MagicPipeline::perform(ringSink);
+    SwordPipeline::perform(ringSink);
+    assert(ring.size() == 8 && ringSink.dropped() == 1);
+
+    AttackRecord record;
+    const char* expectedTexts[] = {"Preparing attack...", "Swinging sword!", "Attack finished.",
+                                   "Preparing attack...", "Casting fireball!", "Attack finished.",
+                                   "Preparing attack...", "Swinging sword!"};
+    for (const char* text : expectedTexts)
     {
-        std::cout << std::string(indent, ' ');
-        m_character.info();
+        assert(ring.try_pop(record));
+        assert(std::string(record.text) == text);
     }
+    assert(!ring.try_pop(record) && record.phase == AttackPhase::Attack);
 
-    void attack() override
-    {
-        std::cout << m_character.name << " attacks for " << m_character.attackPower << " damage!\n";
-    }
+    NullSink null;
+    MagicPipeline::perform(null);
 
-private:
-    Character m_character;
-};
+    std::ostringstream phases;
+    PipelineAttack<MagicPipeline> logged(phases);
+    logged.performAttack();
+    assert(phases.str() == "Preparing attack...\nCasting fireball!\nAttack finished.\n");
 
-class UnitGroup : public GameUnit
-{
-public:
-    void addUnit(GameUnitPtr unit) { m_units.push_back(unit); }
+    PipelineAttack<SwordPipeline, RingSink<8>&> shared(ringSink);
+    static_cast<AttackBehavior&>(shared).performAttack();
+    assert(ring.size() == 3);
 
-    void info(int indent = 0) const override
+    // Писатель и читатель в разных потоках. Ожидание уступает ядро:
+    // на одном ядре пустой цикл крутился бы до конца кванта.
+    RingBuffer<int, 64> numbers;
+    std::thread producer([&]
+    {
+        for (int i = 0; i < 100000; ++i)
+            while (!numbers.try_push(i))
+                std::this_thread::yield();
+    });
+    for (int i = 0, value; i < 100000; ++i)
     {
-        std::cout << std::string(indent, ' ') << "UnitGroup:\n";
-        for (auto& u : m_units) u->info(indent + 2);
+        while (!numbers.try_pop(value))
+            std::this_thread::yield();
+        assert(value == i);
     }
-
-    void attack() override
+    producer.join();
+    assert(numbers.empty());
+
+    World world;
+    auto army   = world.add_group();
+    auto left   = world.add_group(army);
+    auto right  = world.add_group(army);
+    auto scouts = world.add_group(left);
+
+    world.add_unit(left, hero);
+    world.add_unit(right, mage);
+    auto scout = world.add_unit(scouts, archer);
+    auto general = world.add_unit(army, CharacterBuilder().setName("General").setAttack(5).build());
+    world.update();
+
+    assert(world.range(army).size() == 4);
+    assert(world.range(left).size() == 2 && world.own_range(left).size() == 1);
+    assert(world.range(right).size() == 1);
+    assert(world.total_attack(army) == 5 + 25 + 30 + 40);
+    assert(world.total_attack(left) == 25 + 30);
+    assert(world.name(scout) == "Archer" && world.health(scout) == 80);
+    assert(world.unit_ids()[world.range(army).begin] == general);
+
+    std::ostringstream log;
+    world.attack(left, log);
+    assert(log.str() == "Hero attacks for 25 damage!\nArcher attacks for 30 damage!\n");
+
+    std::cout << "\nWorld:\n";
+    GroupView armyView(world, army);
+    armyView.info();
+    armyView.attack();
+
+    // Параллельная атака: задания пишут в свои участки буфера,
+    // порядок событий совпадает с последовательным обходом.
+    auto horde = std::make_shared<UnitGroup>();
+    for (int g = 0; g < 7; ++g)
     {
-        for (auto& u : m_units) u->attack();
+        auto squad = std::make_shared<UnitGroup>();
+        for (int u = 0; u < 3 + 2 * g; ++u)
+            squad->addUnit(std::make_shared<SingleUnit>(
+                CharacterBuilder().setName(g % 2 ? "Orc" : "Goblin").setAttack(g * 10 + u).build()));
+        if (g == 3)
+            squad->addUnit(party);
+        horde->addUnit(squad);
+        horde->addUnit(std::make_shared<SingleUnit>(mage));
     }
+    horde->addUnit(std::make_shared<GroupView>(world, army));
 
-private:
-    std::vector<GameUnitPtr> m_units;
-};
-
-class AttackBehavior
-{
-public:
-    virtual ~AttackBehavior() = default;
+    std::vector<AttackEvent> expected(horde->unitCount());
+    assert(horde->collectAttacks(expected.data()) == expected.data() + expected.size());
+    assert(expected[3].attacker == "Mage" && expected[0].damage == 0);
 
-    void performAttack()
+    ThreadPool pool(4);
+    for (std::size_t grain : {1, 3, 8, 1000})
     {
-        prepare();
-        attack();
-        finish();
+        AttackPlan plan(*horde, grain);
+        assert(plan.size() == expected.size());
+        assert(grain > 1 || plan.items() > 1);
+
+        std::vector<AttackEvent> events(plan.size());
+        for (int tick = 0; tick < 3; ++tick)
+        {
+            plan.run(pool, events);
+            for (std::size_t i = 0; i < events.size(); ++i)
+                assert(events[i].attacker == expected[i].attacker && events[i].damage == expected[i].damage);
+        }
     }
 
-protected:
-    virtual void prepare() { std::cout << "Preparing attack...\n"; }
-    virtual void attack() = 0;
-    virtual void finish() { std::cout << "Attack finished.\n"; }
-};
-
-class SwordAttack : public AttackBehavior
-{
-protected:
-    void attack() override { std::cout << "Swinging sword!\n"; }
-};
-
-class MagicAttack : public AttackBehavior
-{
-protected:
-    void attack() override { std::cout << "Casting fireball!\n"; }
-};
-
-int main()
-{
-    CharacterBuilder builder;
-    auto hero = builder.setName("Hero").setHealth(150).setAttack(25).get();
-    auto mage = builder.setName("Mage").setHealth(100).setAttack(40).get();
-
-    auto heroUnit = std::make_shared<SingleUnit>(hero);
-    auto mageUnit = std::make_shared<SingleUnit>(mage);
-
-    auto party = std::make_shared<UnitGroup>();
-    party->addUnit(heroUnit);
-    party->addUnit(mageUnit);
-
-    party->info();
-    party->attack();
-
-    SwordAttack sword;
-    MagicAttack magic;
-
-    std::cout << "\nHero attacks:\n";
-    sword.performAttack();
+    // Пакетный бой над столбцами World: урон по цели суммируется,
+    // здоровье не уходит ниже нуля, погибшие попадают в список один раз.
+    auto slot = [&](World::UnitId id) { return static_cast<CombatEngine::Slot>(world.slot(id)); };
+    const auto heroId = World::UnitId(0), mageId = World::UnitId(1);
+
+    CombatEngine combat;
+    std::vector<CombatEngine::Hit> hits = {
+        {slot(mageId), slot(scout)}, {slot(mageId), slot(scout)}, {slot(general), slot(heroId)}};
+    auto dead = combat.resolve(world.healths(), world.attack_powers(), hits);
+    assert(dead.size() == 1 && world.unit_ids()[dead[0]] == scout);
+    assert(world.health(scout) == 0 && world.health(heroId) == 145);
+
+    dead = combat.resolve(world.healths(), world.attack_powers(), hits);
+    assert(dead.empty() && world.health(scout) == 0 && world.health(heroId) == 140);
+
+    std::vector<int> health(1000, 50), power(1000, 7);
+    power[3] = INT_MAX;
+    std::vector<CombatEngine::Hit> wave;
+    for (CombatEngine::Slot t = 0; t < 1000; ++t)
+        for (int k = 0; k < 1 + int(t % 8); ++k)
+            wave.push_back({t % 7, t});
+    wave.push_back({3, 999});
+    wave.push_back({3, 999});
+
+    dead = combat.resolve(health, power, wave);
+    for (std::size_t t = 0, d = 0; t < 1000; ++t)
+    {
+        const bool killed = t == 999 || t % 7 == 3 || 7 * (1 + int(t % 8)) >= 50;
+        assert(health[t] == (killed ? 0 : 50 - 7 * (1 + int(t % 8))));
+        if (killed)
+            assert(dead[d++] == t);
+        else
+            assert(d == dead.size() || dead[d] != t);
+    }
 
-    std::cout << "\nMage attacks:\n";
-    magic.performAttack();
+    // Маленький пакет применяется удар за ударом — результат тот же.
+    std::vector<CombatEngine::Hit> few = {{1, 1}, {2, 1}, {3, 0}, {1, 1}};
+    dead = combat.resolve(health, power, few);
+    assert(dead.size() == 1 && dead[0] == 0 && health[1] == 36 - 21);
+    dead = combat.resolve(health, power, few);
+    assert(dead.size() == 1 && dead[0] == 1 && health[1] == 0);
+
+    // Неположительное здоровье не меняется на обоих путях, INT_MIN не
+    // переполняется.
+    std::vector<int> odd = {-5, INT_MIN, 10, 0}, strong(4, INT_MAX);
+    const std::vector<CombatEngine::Hit> all = {{0, 0}, {0, 1}, {0, 2}, {0, 3}};
+    dead = combat.resolve(odd, strong, all);
+    assert(odd == std::vector<int>({-5, INT_MIN, 0, 0}) && dead.size() == 1 && dead[0] == 2);
+
+    std::vector<int> sparse(100, 10), sparse_power(100, INT_MAX);
+    sparse[0] = -5;
+    sparse[1] = INT_MIN;
+    const std::vector<CombatEngine::Hit> two = {{2, 0}, {2, 1}};
+    dead = combat.resolve(sparse, sparse_power, two);
+    assert(sparse[0] == -5 && sparse[1] == INT_MIN && dead.empty());
+
+    AttackEvent single;
+    AttackPlan(*heroUnit).run(pool, {&single, 1});
+    assert(single.attacker == "Hero" && single.damage == 25);
 }
@@ -1,3 +1,9 @@
+#include "AnyBehavior.hpp"
+#include "Population.hpp"
+#include "TypeName.hpp"
+
+#include <cassert>
+#include <cstdint>
 #include <iostream>
 #include <string>
 
@@ -16,6 +22,28 @@ struct BowBehavior
     void attack() const { std::cout << "Shooting arrow!\n"; }
 };
 
+struct DrillBehavior
+{
+    static inline int swings = 0;
+
+    void attack() const { ++swings; }
+};
+
+// Поведение с состоянием и счётчиком живых копий.
+struct QuiverBehavior
+{
+    static inline int alive = 0;
+
+    int* shots;
+    int arrows;
+
+    QuiverBehavior(int* s, int a) : shots(s), arrows(a) { ++alive; }
+    QuiverBehavior(const QuiverBehavior& other) noexcept : shots(other.shots), arrows(other.arrows) { ++alive; }
+    ~QuiverBehavior() { --alive; }
+
+    void attack() const { *shots += arrows; }
+};
+
 template <typename Behavior>
 class Entity : private Behavior
 {
@@ -26,7 +54,7 @@ public:
 
     void info() const
     {
-        std::cout << "Entity using behavior: " << typeid(Behavior).name() << "\n";
+        std::cout << "Entity using behavior: " << type_name_v<Behavior> << "\n";
     }
 };
 
@@ -44,4 +72,97 @@ int main()
 
     archer.info();
     archer.attack();
+
+    static_assert(type_name_v<SwordBehavior> == "SwordBehavior");
+    static_assert(type_name_v<Entity<BowBehavior>> == "Entity<BowBehavior>");
+    static_assert(type_name<const int*>() == "const int*");
+    // ']' внутри имени не обрывает его (GCC пишет "int [3]", Clang — "int[3]").
+    static_assert(type_name<int[3]>().starts_with("int") && type_name<int[3]>().ends_with("[3]"));
+    static_assert(type_name<int(*)[4]>() == "int (*)[4]");
+    static_assert(type_hash_v<int[3]> == fnv1a(type_name<int[3]>()));
+    static_assert(type_hash_v<int[3]> != type_hash_v<int[4]>);
+    static_assert(type_hash_v<SwordBehavior> == fnv1a("SwordBehavior"));
+    static_assert(type_hash_v<SwordBehavior> != type_hash_v<MagicBehavior>);
+
+    // Хэш — константа этапа компиляции, годится для меток switch.
+    auto describe = [](std::uint64_t hash)
+    {
+        switch (hash)
+        {
+        case type_hash_v<SwordBehavior>: return "melee";
+        case type_hash_v<BowBehavior>:   return "ranged";
+        default:                         return "other";
+        }
+    };
+    assert(std::string(describe(type_hash_v<BowBehavior>)) == "ranged");
+    assert(std::string(describe(type_hash_v<MagicBehavior>)) == "other");
+
+    // Смешанная армия: по массиву на поведение, attack() — без косвенных вызовов.
+    using Army = Population<Entity, Deque<SwordBehavior, MagicBehavior, BowBehavior>>;
+    Army army;
+    army.emplace<SwordBehavior>();
+    army.emplace<BowBehavior>();
+    army.emplace<SwordBehavior>();
+    army.emplace<MagicBehavior>();
+
+    assert(army.size() == 4 && army.size<SwordBehavior>() == 2 && army.size<BowBehavior>() == 1);
+    static_assert(Army::holds_v<MagicBehavior> && !Army::holds_v<DrillBehavior>);
+
+    std::cout << "\nArmy attacks:\n";
+    army.attack_all();
+
+    int visited = 0;
+    std::string order;
+    army.for_each_bucket([&](auto bucket) { order += std::to_string(bucket.size()); });
+    army.for_each([&](const auto&) { ++visited; });
+    assert(visited == 4 && order == "211");
+
+    army.remove<SwordBehavior>(0);
+    army.remove<MagicBehavior>(0);
+    assert(army.size() == 2 && army.bucket<MagicBehavior>().empty());
+
+    Population<std::vector, Deque<int, double>> plain;
+    plain.emplace<int>(3, 7);
+    plain.emplace<double>(2);
+    assert(plain.size<int>() == 1 && plain.bucket<int>()[0].size() == 3);
+
+    Population<Entity, Deque<DrillBehavior>> drill;
+    for (int i = 0; i < 100; ++i)
+        drill.emplace<DrillBehavior>();
+    drill.attack_all();
+    drill.attack_all();
+    assert(DrillBehavior::swings == 200);
+
+    // Поведение меняется во время игры без выделения памяти.
+    {
+        int shots = 0;
+        AnyBehavior<> weapon = DrillBehavior{};
+        assert(weapon.holds<DrillBehavior>() && !weapon.holds<QuiverBehavior>());
+        weapon.attack();
+        assert(DrillBehavior::swings == 201);
+
+        weapon.emplace<QuiverBehavior>(&shots, 3);
+        weapon.attack();
+        assert(shots == 3 && QuiverBehavior::alive == 1);
+        assert(weapon.get_if<QuiverBehavior>()->arrows == 3 && !weapon.get_if<DrillBehavior>());
+
+        AnyBehavior<> copy = weapon;
+        copy.get_if<QuiverBehavior>()->arrows = 10;
+        copy.attack();
+        weapon.attack();
+        assert(shots == 16 && QuiverBehavior::alive == 2);
+
+        AnyBehavior<> moved = std::move(copy);
+        assert(!copy && moved && QuiverBehavior::alive == 2);
+
+        moved = SwordBehavior{};
+        assert(moved.holds<SwordBehavior>() && QuiverBehavior::alive == 1);
+
+        weapon.reset();
+        assert(!weapon && QuiverBehavior::alive == 0);
+
+        static_assert(sizeof(AnyBehavior<>) == 5 * sizeof(void*));
+        static_assert(!AnyBehavior<8>::fits_v<QuiverBehavior>);
+    }
+    assert(QuiverBehavior::alive == 0);
 }
@@ -0,0 +1,49 @@
+// Интерфейс модуля Rational — тот же task0601::Rational, что и в
+// Rational.hpp; определения — в RationalModule.cpp. Стандартная
+// библиотека импортируется заголовочными модулями: их надо собрать
+// заранее (g++ -fmodules-ts -x c++-system-header iostream ...).
+export module Rational; // название модуля
+
+import <compare>;
+import <iostream>;
+import <numeric>;
+
+export namespace task0601 {
+
+class Rational {
+public:
+    Rational(int num = 0, int den = 1) : m_num(num), m_den(den) { reduce(); }
+
+    explicit operator double() const { return static_cast<double>(m_num) / m_den; }
+
+    // Арифметика с присваиванием
+    Rational& operator+=(const Rational& other);
+    Rational& operator-=(const Rational& other);
+    Rational& operator*=(const Rational& other);
+    Rational& operator/=(const Rational& other);
+
+    // Префиксный и постфиксный инкремент/декремент
+    Rational& operator++();
+    Rational& operator--();
+    Rational operator++(int);
+    Rational operator--(int);
+
+    friend Rational operator+(Rational lhs, const Rational& rhs) { return lhs += rhs; }
+    friend Rational operator-(Rational lhs, const Rational& rhs) { return lhs -= rhs; }
+    friend Rational operator*(Rational lhs, const Rational& rhs) { return lhs *= rhs; }
+    friend Rational operator/(Rational lhs, const Rational& rhs) { return lhs /= rhs; }
+
+    friend std::strong_ordering operator<=>(const Rational& lhs, const Rational& rhs);
+    friend bool operator==(const Rational& lhs, const Rational& rhs);
+
+    friend std::istream& operator>>(std::istream& is, Rational& r);
+    friend std::ostream& operator<<(std::ostream& os, const Rational& r);
+
+private:
+    void reduce();
+
+    int m_num = 0;
+    int m_den = 1;
+};
+
+} // namespace task0601
@@ -0,0 +1 @@
+#include "Rational.hpp"
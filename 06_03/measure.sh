@@ -0,0 +1,241 @@
+#!/usr/bin/env bash
+# Время сборки Rational в четырёх раскладках:
+#   split  — 06_01: Rational.hpp + Rational.cpp + main.cpp;
+#   header — 06_02: всё в Rational.hpp;
+#   pch    — 06_02, стандартные заголовки предкомпилированы (06_03/pch.hpp);
+#   module — 06_01/Rational.ixx + RationalModule.cpp и main.cpp с import,
+#            стандартная библиотека — заголовочными модулями.
+# Каждый вариант собирается с нуля N раз; каждый шаг (компиляция,
+# компоновка) запускается через rusage: wall, user, sys, пиковая память.
+#
+# Стоимость заголовков — отдельной сборкой. У clang — по -ftime-trace
+# (события Source, с вложенными заголовками). У GCC -ftime-trace нет:
+# для каждого заголовка, который единицы варианта подключают напрямую,
+# замеряется -fsyntax-only единицы из одного #include с флагами варианта
+# за вычетом пустой единицы; у module — шаги сборки заголовочных модулей.
+#
+# Итог — таблица на экране и JSON-отчёт (нужен jq).
+# Запуск из корня репозитория:
+#   06_03/measure.sh [-n повторов, 5] [-o отчёт, build/06_03/report.json]
+# Компилятор — $CXX, по умолчанию clang++, если он есть, иначе g++.
+
+set -euo pipefail
+
+runs=5
+report=build/06_03/report.json
+while getopts n:o: opt; do
+    case $opt in
+        n) runs=$OPTARG ;;
+        o) report=$OPTARG ;;
+        *) exit 2 ;;
+    esac
+done
+
+command -v jq >/dev/null || { echo "measure.sh: нужен jq" >&2; exit 1; }
+
+if [[ -z ${CXX:-} ]]; then
+    if command -v clang++ >/dev/null; then CXX=clang++; else CXX=g++; fi
+fi
+if $CXX --version | grep -qi clang; then family=clang; else family=gcc; fi
+
+root=$PWD
+out=$root/build/06_03
+flags=(-std=c++20 -Wall -Wextra -I"$root")   # корень — для Instrument.hpp
+variants=(split header pch module)
+# Стандартные заголовки, которые импортируют Rational.ixx и main.cpp.
+std_units=(compare iostream numeric cassert sstream cmath)
+
+mkdir -p "$out"
+$CXX -std=c++20 -O2 06_03/rusage.cpp -o "$out/rusage"
+
+trace=()
+log=/dev/null
+
+# Один шаг сборки под rusage, строка в журнал $log.
+step() { "$out/rusage" "$log" "$@"; }
+
+##################################################################
+
+# build_<вариант> <каталог> — сборка с нуля в пустом каталоге; $trace —
+# дополнительные флаги для единиц трансляции.
+
+build_split() {
+    local d=$1
+    step $CXX "${flags[@]}" "${trace[@]}" -c 06_01/Rational.cpp -o "$d/Rational.o"
+    step $CXX "${flags[@]}" "${trace[@]}" -c 06_01/main.cpp -o "$d/main.o"
+    step $CXX "$d/Rational.o" "$d/main.o" -o "$d/main"
+}
+
+build_header() {
+    local d=$1
+    step $CXX "${flags[@]}" "${trace[@]}" -c 06_02/Rational.cpp -o "$d/Rational.o"
+    step $CXX "${flags[@]}" "${trace[@]}" -c 06_02/main.cpp -o "$d/main.o"
+    step $CXX "$d/Rational.o" "$d/main.o" -o "$d/main"
+}
+
+# Флаги, подключающие предкомпилированный $1/pch.hpp.
+pch_flags() {
+    if [[ $family == clang ]]; then echo "-include-pch $1/pch.hpp.pch"; else echo "-include $1/pch.hpp"; fi
+}
+
+build_pch() {
+    local d=$1 ext=gch
+    [[ $family == clang ]] && ext=pch
+    cp 06_03/pch.hpp "$d/"
+    step $CXX "${flags[@]}" -x c++-header "$d/pch.hpp" -o "$d/pch.hpp.$ext"
+
+    local use
+    read -ra use <<< "$(pch_flags "$d")"
+    step $CXX "${flags[@]}" "${trace[@]}" "${use[@]}" -c 06_02/Rational.cpp -o "$d/Rational.o"
+    step $CXX "${flags[@]}" "${trace[@]}" "${use[@]}" -c 06_02/main.cpp -o "$d/main.o"
+    step $CXX "$d/Rational.o" "$d/main.o" -o "$d/main"
+}
+
+build_module() {
+    local d=$1 h
+    sed -e 's/^#include "Rational.hpp"/import Rational;/' -e 's/^#include <\(.*\)>/import <\1>;/' \
+        06_01/main.cpp > "$d/main.cpp"
+
+    if [[ $family == clang ]]; then
+        local units=()
+        for h in "${std_units[@]}"; do
+            step $CXX "${flags[@]}" -x c++-system-header --precompile "$h" -o "$d/$h.pcm"
+            units+=("-fmodule-file=$d/$h.pcm")
+        done
+        step $CXX "${flags[@]}" "${units[@]}" --precompile -x c++-module 06_01/Rational.ixx -o "$d/Rational.pcm"
+        step $CXX -c "$d/Rational.pcm" -o "$d/Rational.o"
+        units+=("-fmodule-file=Rational=$d/Rational.pcm")
+        step $CXX "${flags[@]}" "${trace[@]}" "${units[@]}" -c 06_01/RationalModule.cpp -o "$d/RationalModule.o"
+        step $CXX "${flags[@]}" "${trace[@]}" "${units[@]}" -c "$d/main.cpp" -o "$d/main.o"
+    else
+        # GCC ищет и кладёт BMI в gcm.cache текущего каталога.
+        (
+            cd "$d"
+            for h in "${std_units[@]}"; do
+                step $CXX "${flags[@]}" -fmodules-ts -c -x c++-system-header "$h"
+            done
+            step $CXX "${flags[@]}" -fmodules-ts -c -x c++ "$root/06_01/Rational.ixx" -o Rational.o
+            step $CXX "${flags[@]}" -fmodules-ts -c "$root/06_01/RationalModule.cpp" -o RationalModule.o
+            step $CXX "${flags[@]}" -fmodules-ts -c main.cpp -o main.o
+        )
+    fi
+    step $CXX "$d/Rational.o" "$d/RationalModule.o" "$d/main.o" -o "$d/main"
+}
+
+##################################################################
+
+# Стоимость заголовков варианта $1, собранного в $2, — JSON-массив
+# [{"header": ..., "ms": ...}] по убыванию.
+
+headers_clang() {
+    local d=$2
+    rm -rf "$d" && mkdir -p "$d"
+    trace=(-ftime-trace)
+    build_"$1" "$d" > /dev/null
+    trace=()
+    jq -s '[.[].traceEvents[] | select(.name == "Source") | {header: .args.detail, us: .dur}]
+           | group_by(.header)
+           | map({header: .[0].header, ms: (map(.us) | add / 1000)})
+           | sort_by(-.ms)' "$d"/*.json
+}
+
+headers_gcc() {
+    local v=$1 d=$2 tus use=() h i
+    if [[ $v == module ]]; then
+        jq -s '[.[] | select(.command | test("c\\+\\+-system-header")) | {header: (.command | split(" ") | last), ms: .wall_ms}]
+               | group_by(.header)
+               | map({header: .[0].header, ms: (map(.ms) | sort | .[length / 2 | floor])})
+               | sort_by(-.ms)' "$out/$v"/run*.jsonl
+        return
+    fi
+
+    rm -rf "$d" && mkdir -p "$d"
+    build_"$v" "$d" > /dev/null
+    [[ $v == split ]] && tus=(06_01/Rational.cpp 06_01/main.cpp) || tus=(06_02/Rational.cpp 06_02/main.cpp)
+    [[ $v == pch ]] && read -ra use <<< "$(pch_flags "$d")"
+
+    # Медиана wall_ms -fsyntax-only единицы $d/probe.cpp.
+    probe() {
+        rm -f "$d/probe.jsonl"
+        for ((i = 0; i < runs; ++i)); do
+            log=$d/probe.jsonl step $CXX "${flags[@]}" "${use[@]}" -fsyntax-only "$d/probe.cpp"
+        done
+        jq -s 'map(.wall_ms) | sort | .[length / 2 | floor]' "$d/probe.jsonl"
+    }
+
+    : > "$d/probe.cpp"
+    local empty
+    empty=$(probe)
+
+    # -H печатает подключённые заголовки, по точке на уровень вложенности.
+    for h in $(for i in "${tus[@]}"; do
+                   $CXX "${flags[@]}" "${use[@]}" -H -fsyntax-only "$i" 2>&1 >/dev/null | sed -n 's/^\. //p'
+               done | sort -u); do
+        printf '#include "%s"\n' "$(realpath "$h")" > "$d/probe.cpp"
+        jq -n --arg header "$h" --argjson ms "$(probe)" --argjson empty "$empty" '{header: $header, ms: ($ms - $empty)}'
+    done | jq -s 'sort_by(-.ms)'
+}
+
+header_method() {
+    if [[ $family == clang ]]; then echo time-trace
+    elif [[ $1 == module ]]; then echo header-units
+    else echo isolated; fi
+}
+
+##################################################################
+
+echo "Compiler: $($CXX --version | head -1), $runs runs per variant"
+
+for v in "${variants[@]}"; do
+    rm -rf "${out:?}/$v"
+    for ((run = 1; run <= runs; ++run)); do
+        d=$out/$v/build
+        rm -rf "$d" && mkdir -p "$d"
+        log=$out/$v/run$run.jsonl
+        build_"$v" "$d" > /dev/null
+    done
+    "$d/main" > /dev/null
+
+    # Промежуточные файлы: объектные, BMI, PCH.
+    find "$d" -type f \( -name '*.o' -o -name '*.gcm' -o -name '*.pcm' -o -name '*.gch' -o -name '*.pch' \) \
+        -printf '%s\n' | jq -s 'add' > "$out/$v/objects"
+    stat -c %s "$d/main" > "$out/$v/binary"
+
+    log=/dev/null
+    headers_"$family" "$v" "$out/$v/headers" > "$out/$v/headers.json"
+done
+
+# Отчёт: по каждому варианту — сумма шагов за сборку (wall, user, sys) и
+# максимум памяти; по шагам — медианы.
+for v in "${variants[@]}"; do
+    for f in "$out/$v"/run*.jsonl; do jq -s . "$f"; done \
+    | jq -s --arg name "$v" --arg method "$(header_method "$v")" \
+            --argjson objects "$(cat "$out/$v/objects")" --argjson binary "$(cat "$out/$v/binary")" \
+            --slurpfile headers "$out/$v/headers.json" '
+        def median: sort | if length % 2 == 1 then .[length / 2 | floor] else (.[length / 2 - 1] + .[length / 2]) / 2 end;
+        def r: . * 100 | round / 100;
+        def stats: {min: min, median: median, mean: (add / length), max: max} | map_values(r);
+        {($name): {
+            wall_ms: map(map(.wall_ms) | add) | stats,
+            user_ms: map(map(.user_ms) | add) | stats,
+            sys_ms: map(map(.sys_ms) | add) | stats,
+            peak_rss_kb: map(map(.rss_kb) | max) | max,
+            objects_bytes: $objects,
+            binary_bytes: $binary,
+            steps: (transpose | map({
+                command: .[0].command,
+                wall_ms: map(.wall_ms) | median,
+                user_ms: map(.user_ms) | median,
+                rss_kb: map(.rss_kb) | max})),
+            headers: {method: $method, top: ($headers[0][:20] | map(.ms |= r))}
+        }}'
+done | jq -s --arg compiler "$($CXX --version | head -1)" --arg family "$family" \
+             --arg flags "${flags[*]}" --argjson runs "$runs" '
+    {compiler: $compiler, family: $family, flags: $flags, runs: $runs, variants: add}' > "$report"
+
+echo "Report: $report"
+jq -r '.variants | to_entries[] | [.key, .value.wall_ms.median, .value.user_ms.median,
+        (.value.peak_rss_kb / 1024), .value.objects_bytes, .value.binary_bytes]
+       | @tsv' "$report" \
+| awk 'BEGIN { printf "%-8s %10s %10s %9s %10s %10s\n", "variant", "wall ms", "user ms", "RSS MB", "objects", "binary" }
+       { printf "%-8s %10.0f %10.0f %9.1f %10d %10d\n", $1, $2, $3, $4, $5, $6 }'
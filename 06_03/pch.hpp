@@ -0,0 +1,7 @@
+// Предкомпилируемый заголовок для варианта pch в measure.sh: всё
+// стандартное, что тянут 06_02/Rational.hpp и 06_02/main.cpp.
+#include <cassert>
+#include <cmath>
+#include <iostream>
+#include <numeric>
+#include <sstream>
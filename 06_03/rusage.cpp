@@ -0,0 +1,72 @@
+// Запуск команды с замером ресурсов — замена /usr/bin/time для measure.sh.
+//   rusage <журнал.jsonl> <команда> [аргументы...]
+// Дописывает в журнал строку
+//   {"command": "...", "wall_ms": ..., "user_ms": ..., "sys_ms": ..., "rss_kb": ...}
+// и завершается с кодом команды. user/sys и пиковая память — по wait4,
+// то есть вместе с дочерними процессами драйвера (cc1plus, ld).
+
+#include <chrono>
+#include <cstdio>
+#include <string>
+
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+static double ms(const timeval& t) { return t.tv_sec * 1e3 + t.tv_usec / 1e3; }
+
+static std::string quoted(const std::string& s)
+{
+    std::string out = "\"";
+    for (char c : s)
+    {
+        if (c == '"' || c == '\\')
+            out += '\\';
+        out += c;
+    }
+    return out + '"';
+}
+
+int main(int argc, char** argv)
+{
+    if (argc < 3)
+    {
+        std::fprintf(stderr, "usage: %s <log.jsonl> <command> [args...]\n", argv[0]);
+        return 2;
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    const pid_t pid = fork();
+    if (pid == 0)
+    {
+        execvp(argv[2], argv + 2);
+        std::perror(argv[2]);
+        _exit(127);
+    }
+
+    int status = 0;
+    rusage usage{};
+    if (pid < 0 || wait4(pid, &status, 0, &usage) < 0)
+    {
+        std::perror("rusage");
+        return 2;
+    }
+    auto stop = std::chrono::steady_clock::now();
+
+    std::string command = argv[2];
+    for (int i = 3; i < argc; ++i)
+        command += std::string(" ") + argv[i];
+
+    FILE* log = std::fopen(argv[1], "a");
+    if (log == nullptr)
+    {
+        std::perror(argv[1]);
+        return 2;
+    }
+    std::fprintf(log, "{\"command\": %s, \"wall_ms\": %.2f, \"user_ms\": %.2f, \"sys_ms\": %.2f, \"rss_kb\": %ld}\n",
+                 quoted(command).c_str(), std::chrono::duration<double, std::milli>(stop - start).count(),
+                 ms(usage.ru_utime), ms(usage.ru_stime), usage.ru_maxrss);
+    std::fclose(log);
+
+    return WIFEXITED(status) ? WEXITSTATUS(status) : 128 + WTERMSIG(status);
+}
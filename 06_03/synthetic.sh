@@ -0,0 +1,181 @@
+#!/usr/bin/env bash
+# Модули против заголовков на синтетическом проекте: U единиц трансляции
+# (по умолчанию 200), каждая пользуется Rational и Variant, плюс main.
+#   header — #include "Rational.hpp" и "Variant.hpp" (06_01, корень);
+#   module — import Rational; import Variant; (06_01/Rational.ixx,
+#            Variant.ixx), стандартная библиотека — заголовочными модулями.
+# Проект — Makefile с явным графом: BMI модуля собирается одним правилом
+# вместе с его объектным файлом, и все импортёры зависят от него.
+#
+# Замеры (make -jJ под rusage, медиана по N повторам):
+#   clean     — сборка с нуля;
+#   noop      — повторный make без изменений;
+#   impl      — изменена реализация (Rational.cpp / RationalModule.cpp);
+#   interface — изменён интерфейс (Rational.hpp / Rational.ixx).
+# Итог — таблица и JSON-отчёт (нужен jq).
+#
+# Запуск из корня репозитория (только GCC: сборка модулей — по его флагам):
+#   06_03/synthetic.sh [-u единиц, 200] [-n повторов, 1] [-j задач, nproc]
+#                      [-o отчёт, build/06_03/synthetic.json]
+
+set -euo pipefail
+
+units=200
+runs=1
+jobs=$(nproc)
+report=build/06_03/synthetic.json
+while getopts u:n:j:o: opt; do
+    case $opt in
+        u) units=$OPTARG ;;
+        n) runs=$OPTARG ;;
+        j) jobs=$OPTARG ;;
+        o) report=$OPTARG ;;
+        *) exit 2 ;;
+    esac
+done
+
+command -v jq >/dev/null || { echo "synthetic.sh: нужен jq" >&2; exit 1; }
+CXX=${CXX:-g++}
+
+root=$PWD
+out=$root/build/06_03/synthetic
+mkdir -p "$out"
+$CXX -std=c++20 -O2 06_03/rusage.cpp -o "$out/rusage"
+
+##################################################################
+
+# Единица трансляции номер $2 варианта $1.
+unit() {
+    if [[ $1 == header ]]; then
+        printf '#include "Rational.hpp"\n#include "Variant.hpp"\n'
+    else
+        printf 'import Rational;\nimport Variant;\n'
+    fi
+    cat <<EOF
+
+using task0601::Rational;
+
+Rational unit_$2(int k)
+{
+    using Value = Variant<int, Rational>;
+    const Value values[] = {k, Rational(k, $2 + 2)};
+
+    Rational total;
+    for (const Value& value : values)
+        total += visit(Overloaded{[](int x) { return Rational(x); },
+                                  [](const Rational& r) { return r * Rational(1, $2 + 1); }}, value);
+    return total;
+}
+EOF
+}
+
+main_unit() {
+    local i
+    [[ $1 == header ]] && echo '#include "Rational.hpp"' || echo 'import Rational;'
+    printf '\nusing task0601::Rational;\n\n'
+    for ((i = 0; i < units; ++i)); do echo "Rational unit_$i(int k);"; done
+    printf '\nint main()\n{\n    Rational total;\n'
+    for ((i = 0; i < units; ++i)); do echo "    total += unit_$i(1);"; done
+    printf '    return static_cast<double>(total) > 0 ? 0 : 1;\n}\n'
+}
+
+makefile_header() {
+    cat <<'EOF'
+FLAGS = -std=c++20 -Wall -Wextra -Isrc
+UNITS = $(patsubst %.cpp,%.o,$(wildcard unit_*.cpp))
+
+app: main.o Rational.o $(UNITS)
+	$(CXX) $^ -o $@
+
+Rational.o: src/Rational.cpp src/Rational.hpp src/Instrument.hpp
+	$(CXX) $(FLAGS) -c $< -o $@
+
+%.o: %.cpp src/Rational.hpp src/Variant.hpp src/Deque.hpp
+	$(CXX) $(FLAGS) -c $< -o $@
+EOF
+}
+
+makefile_module() {
+    cat <<'EOF'
+FLAGS = -std=c++20 -Wall -Wextra -fmodules-ts
+UNITS = $(patsubst %.cpp,%.o,$(wildcard unit_*.cpp))
+STD = algorithm array cassert compare cstddef cstdint functional iostream limits new numeric type_traits utility
+
+app: main.o Rational.o RationalModule.o Variant.o $(UNITS)
+	$(CXX) $^ -o $@
+
+# Заголовочные модули стандартной библиотеки, по штампу на каждый;
+# сами BMI — в gcm.cache/usr/...
+std/%:
+	$(CXX) $(FLAGS) -c -x c++-system-header $*
+	@mkdir -p std && touch $@
+
+# Rational.o и BMI gcm.cache/Rational.gcm — одним вызовом; импортёры
+# зависят от Rational.o.
+Rational.o: src/Rational.ixx $(STD:%=std/%)
+	$(CXX) $(FLAGS) -c -x c++ $< -o $@
+
+Variant.o: src/Variant.ixx src/Variant.hpp src/Deque.hpp $(STD:%=std/%)
+	$(CXX) $(FLAGS) -c -x c++ $< -o $@
+
+RationalModule.o: src/RationalModule.cpp src/Instrument.hpp Rational.o
+	$(CXX) $(FLAGS) -c $< -o $@
+
+%.o: %.cpp Rational.o Variant.o
+	$(CXX) $(FLAGS) -c $< -o $@
+EOF
+}
+
+# Проект варианта $1 в пустом каталоге $2.
+generate() {
+    local d=$2 i
+    rm -rf "$d" && mkdir -p "$d/src"
+    cp 06_01/Rational.hpp 06_01/Rational.cpp 06_01/Rational.ixx 06_01/RationalModule.cpp Instrument.hpp \
+       Variant.hpp Variant.ixx Deque.hpp "$d/src/"
+    for ((i = 0; i < units; ++i)); do unit "$1" "$i" > "$d/unit_$i.cpp"; done
+    main_unit "$1" > "$d/main.cpp"
+    makefile_"$1" > "$d/Makefile"
+}
+
+# make в $1 под rusage, строка в журнал $2.
+build() { "$out/rusage" "$2" make -s -C "$1" -j"$jobs" CXX="$CXX" > /dev/null; }
+
+##################################################################
+
+echo "Compiler: $($CXX --version | head -1), $units units, -j$jobs, $runs runs"
+
+for v in header module; do
+    rm -f "$out/$v".*.jsonl
+    [[ $v == header ]] && files=(Rational.cpp Rational.hpp) || files=(RationalModule.cpp Rational.ixx)
+    for ((run = 1; run <= runs; ++run)); do
+        d=$out/$v
+        generate "$v" "$d"
+        build "$d" "$out/$v.clean.jsonl"
+        "$d/app"
+        build "$d" "$out/$v.noop.jsonl"
+        touch "$d/src/${files[0]}"
+        build "$d" "$out/$v.impl.jsonl"
+        touch "$d/src/${files[1]}"
+        build "$d" "$out/$v.interface.jsonl"
+    done
+done
+
+for v in header module; do
+    for step in clean noop impl interface; do
+        jq -s --arg step "$step" '
+            def median: sort | if length % 2 == 1 then .[length / 2 | floor] else (.[length / 2 - 1] + .[length / 2]) / 2 end;
+            {($step): {wall_ms: (map(.wall_ms) | median), user_ms: (map(.user_ms) | median),
+                       peak_rss_kb: (map(.rss_kb) | max)}}' "$out/$v.$step.jsonl"
+    done | jq -s --arg name "$v" '{($name): add}'
+done | jq -s --arg compiler "$($CXX --version | head -1)" --argjson units "$units" \
+             --argjson jobs "$jobs" --argjson runs "$runs" '
+    add as $v
+    | {compiler: $compiler, units: $units, jobs: $jobs, runs: $runs, variants: $v,
+       speedup: ($v.header | with_entries(.value = (.value.wall_ms / $v.module[.key].wall_ms * 100 | round / 100)))}' \
+    > "$report"
+
+echo "Report: $report"
+jq -r '.variants as $v | ["clean", "noop", "impl", "interface"][]
+       | [., $v.header[.].wall_ms, $v.module[.].wall_ms, ($v.header[.].wall_ms / $v.module[.].wall_ms)] | @tsv' "$report" \
+| awk 'BEGIN { printf "%-10s %12s %12s %8s\n", "build", "header ms", "module ms", "speedup" }
+       { printf "%-10s %12.0f %12.0f %7.2fx\n", $1, $2, $3, $4 }'
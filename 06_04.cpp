@@ -0,0 +1,314 @@
+#include "Rational.hpp"
+#include "RationalColumn.hpp"
+#include "RationalSum.hpp"
+#include "RationalText.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <csignal>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <sys/wait.h>
+#include <unistd.h>
+
+using R64  = Rational<std::int64_t>;
+using R128 = Rational<__int128>;
+
+// Падает ли f на assert: проверяется в дочернем процессе.
+template <typename F>
+bool aborts(F f)
+{
+    const pid_t pid = ::fork();
+    if (pid == 0)
+    {
+        ::close(STDERR_FILENO);   // без сообщения assert в выводе теста
+        f();
+        ::_exit(0);
+    }
+    int status = 0;
+    ::waitpid(pid, &status, 0);
+    return WIFSIGNALED(status) && WTERMSIG(status) == SIGABRT;
+}
+
+template <typename R>
+void test_arithmetic()
+{
+    R x = 1, y(2, 1);
+    assert(static_cast<double>(x) == 1.0);
+    assert((x += y) == R(3));
+    assert((x -= y) == R(1));
+    assert((x *= y) == R(2));
+    assert((x /= y) == R(1));
+
+    assert((x++) == R(1));
+    assert((x--) == R(2));
+    assert((++y) == R(3));
+    assert((--y) == R(2));
+
+    assert((x - y) == R(-1));
+    assert((x / y) == R(1, 2));
+    assert(R(6, -8) == R(-3, 4) && R(6, -8).denominator() == 4);
+    assert(R(0, -5) == R(0) && R(0, -5).denominator() == 1);
+
+    // Знак знаменателя переносится проверенным отрицанием: -min не
+    // представимо (assert), а min + 1 ещё можно.
+    using Int = typename R::value_type;
+    using U = typename rational_detail::Traits<Int>::Unsigned;
+    const Int min = static_cast<Int>(U(1) << (sizeof(Int) * 8 - 1));
+    assert(R(min + 1, -1) == R(-(min + 1)) && -R(min + 1) == R(-(min + 1)));
+    assert(R(1) / R(min + 1) == R(-1, -(min + 1)));
+    assert(aborts([=] { static_cast<void>(R(1) / R(min)); }));
+
+    R a(1, 2), b(2, 4), c(3, 4), d(-1, 2);
+    assert(a == b && a != c);
+    assert(a < c && c > a && a <= b && c >= a && d < a);
+    assert(R(1, 3) + R(1, 6) == R(1, 2));
+    assert(R(5, 12) - R(1, 12) == R(1, 3));
+    assert(R(4, 9) * R(3, 8) == R(1, 6));
+    assert(R(-4, 9) / R(-2, 3) == R(2, 3));
+    assert(R(3, 5).reciprocal() == R(5, 3) && R(-3, 5).reciprocal() == R(-5, 3));
+
+    std::stringstream in("10/20 -3/-9");
+    R z, w;
+    in >> z >> w;
+    assert(z == R(1, 2) && w == R(1, 3));
+
+    std::stringstream out;
+    out << z << ' ' << R(-7, 3);
+    assert(out.str() == "1/2 -7/3");
+}
+
+template <typename R>
+void test_sum()
+{
+    using Int = typename R::value_type;
+
+    // Знаменатели — делители 360: сумма остаётся в int64, а RationalSum
+    // то и дело упирается в переполнение и сокращает.
+    std::mt19937 rng(3);
+    const int dens[] = {1, 2, 3, 4, 5, 6, 8, 9, 10, 12, 15, 18, 20, 24, 30, 36, 40, 45, 60, 72, 90, 120, 180, 360};
+    std::vector<R> values;
+    for (int i = 0; i < 10000; ++i)
+        values.emplace_back(Int(int(rng() % 201) - 100), Int(dens[rng() % std::size(dens)]));
+
+    R expected;
+    RationalSum<Int> acc;
+    for (const R& v : values)
+    {
+        expected += v;
+        acc += v;
+    }
+    assert(acc.value() == expected);
+    assert(sum(values) == expected);
+    assert(sum(std::span<const R>(values).first(100)) == sum(std::vector<R>(values.begin(), values.begin() + 100)));
+
+    assert(sum(std::vector<R>{}) == R(0));
+    assert(sum(std::vector<R>{R(1, 3), R(-1, 3)}).denominator() == 1);
+    assert(sum(std::vector<R>(129, R(1, 129))) == R(1));
+
+    // Взаимно простые большие знаменатели: отложить нельзя даже после
+    // сокращения, срабатывает точное сложение.
+    const Int p = 2305843009213693951, q = 2305843009213693949; // 2^61 - 1, 2^61 - 3
+    RationalSum<Int> hard;
+    hard += R(1, p);
+    hard += R(1, q);
+    hard += R(-1, p);
+    assert(hard.value() == R(1, q));
+
+    // value() посреди суммы, равной нулю, сбрасывает знаменатель в 1 —
+    // кэш множителей не должен это пропустить.
+    RationalSum<Int> zero;
+    zero += R(1, 2);
+    zero += R(-1, 2);
+    assert(zero.value() == R(0));
+    zero += R(1, 2);
+    assert(zero.value() == R(1, 2));
+}
+
+template <typename Int>
+void test_column()
+{
+    using R = Rational<Int>;
+
+    // Длина не кратна блоку; значения с общими множителями, нулями и
+    // знаменателем 1, чтобы НОД и сокращение были не тривиальны.
+    std::mt19937 rng(11);
+    std::vector<R> a, b;
+    for (int i = 0; i < 1000; ++i)
+    {
+        const Int scale = Int(1) << (rng() % 5);
+        a.emplace_back(Int(int(rng() % 20001) - 10000) * scale, Int(rng() % 3000 + 1) * scale);
+        b.emplace_back(Int(int(rng() % 201) - 100), i % 7 ? Int(rng() % 4000 + 1) : Int(1));
+    }
+    a[5] = R(0);
+    b[6] = R(0);
+
+    const RationalColumn<Int> ca(a), cb(b);
+    assert(ca.to_vector() == a && ca[17] == a[17]);
+
+    RationalColumn<Int> sum_col, product;
+    add(ca, cb, sum_col);
+    mul(ca, cb, product);
+
+    std::vector<std::int8_t> order(a.size());
+    std::vector<double> approx(a.size());
+    compare(ca, cb, order);
+    to_double(ca, approx);
+
+    for (std::size_t i = 0; i < a.size(); ++i)
+    {
+        assert(sum_col[i] == a[i] + b[i]);
+        assert(product[i] == a[i] * b[i]);
+        assert(order[i] == ((a[i] <=> b[i]) < 0 ? -1 : (a[i] <=> b[i]) > 0 ? 1 : 0));
+        assert(approx[i] == static_cast<double>(a[i]));
+    }
+
+    // На месте: out совпадает с аргументом.
+    RationalColumn<Int> acc = ca, square = cb;
+    add(acc, cb, acc);
+    mul(square, square, square);
+    for (std::size_t i = 0; i < a.size(); ++i)
+        assert(acc[i] == a[i] + b[i] && square[i] == b[i] * b[i]);
+
+    using rational_detail::block;
+    std::uint32_t u[block] = {12, 7, 1u << 31, 5, 3 * 1024}, v[block] = {18, 0, 1u << 20, 5, 9 * 4096};
+    std::fill(u + 5, u + block, 1u);
+    rational_detail::gcd_lanes(u, v);
+    assert(u[0] == 6 && u[1] == 7 && u[2] == 1u << 20 && u[3] == 5 && u[4] == 3 * 1024 && u[5] == 1);
+}
+
+template <typename Int>
+void test_text()
+{
+    using R = Rational<Int>;
+
+    auto parse = [](const char* text, R& value)
+    {
+        return from_chars(text, text + std::strlen(text), value);
+    };
+
+    R r;
+    auto result = parse("10/20 rest", r);
+    assert(result.ec == std::errc{} && *result.ptr == ' ' && r == R(1, 2));
+    assert(parse("-3/-9", r).ec == std::errc{} && r == R(1, 3));
+    assert(parse("7/-14", r).ec == std::errc{} && r == R(-1, 2) && r.denominator() == 2);
+    assert(parse("42", r).ec == std::errc{} && r == R(42));
+
+    r = R(5);
+    for (const char* bad : {"", "-", "/2", "+1/2", " 1/2", "1/", "1/-", "1/0", "x"})
+    {
+        result = parse(bad, r);
+        assert(result.ec == std::errc::invalid_argument && r == R(5));
+    }
+
+    // Ровно на границах Int и за ними.
+    using U = typename rational_detail::Traits<Int>::Unsigned;
+    const Int max = Int(~U(0) >> 1), min = Int(-max - 1);
+    char text[128];
+    for (const R& edge : {R(max), R(min), R(min, max), R(1, max)})
+    {
+        const auto written = to_chars(text, text + sizeof(text), edge);
+        assert(written.ec == std::errc{} && from_chars(text, written.ptr, r).ec == std::errc{} && r == edge);
+    }
+    assert(parse("99999999999999999999999999999999999999999/2", r).ec == std::errc::result_out_of_range);
+    assert(parse("1/99999999999999999999999999999999999999999", r).ec == std::errc::result_out_of_range);
+
+    // Смена знака при отрицательном знаменателе: -min непредставимо.
+    char bad[128];
+    char* end = rational_detail::format_int(bad, bad + sizeof(bad), min);
+    end = std::strcpy(end, "/-1") + 3;
+    r = R(5);
+    assert(from_chars(bad, end, r).ec == std::errc::result_out_of_range && r == R(5));
+    end = rational_detail::format_int(std::strcpy(bad, "1/") + 2, bad + sizeof(bad), min);
+    assert(from_chars(bad, end, r).ec == std::errc::result_out_of_range && r == R(5));
+
+    // Запись: всегда num/den, при нехватке места — value_too_large.
+    char buffer[96];
+    auto written = to_chars(buffer, buffer + sizeof(buffer), R(-7, 3));
+    assert(written.ec == std::errc{} && std::string(buffer, written.ptr) == "-7/3");
+    assert(to_chars(buffer, buffer + 3, R(-7, 3)).ec == std::errc::value_too_large);
+    assert(to_chars(buffer, buffer + 2, R(-7, 3)).ec == std::errc::value_too_large);
+
+    // Столбец: пробельные символы между дробями, первая ошибка — позиция.
+    const std::string column_text = " 1/2\t-4/6\n\n7 10/20\r\n";
+    RationalColumn<Int> column;
+    result = parse_column(column_text.data(), column_text.data() + column_text.size(), column);
+    assert(result.ec == std::errc{} && column.size() == 4);
+    assert(column[1] == R(-2, 3) && column[2] == R(7) && column[3] == R(1, 2));
+    const std::vector<R> expected = column.to_vector();
+
+    const std::string broken = "1/2 3/0 5";
+    result = parse_column(broken.data(), broken.data() + broken.size(), column);
+    assert(result.ec == std::errc::invalid_argument && result.ptr == broken.data() + 4 && column.size() == 5);
+    const std::string glued = "1/2x";
+    assert(parse_column(glued.data(), glued.data() + glued.size(), column).ec == std::errc::invalid_argument);
+
+    // Файл через mmap.
+    char path[] = "/tmp/rational_XXXXXX";
+    const int fd = ::mkstemp(path);
+    assert(fd >= 0);
+    const ssize_t size = ::write(fd, column_text.data(), column_text.size());
+    ::close(fd);
+    assert(size == ssize_t(column_text.size()));
+    RationalColumn<Int> loaded;
+    assert(load_column(path, loaded) == std::errc{} && loaded.to_vector() == expected);
+    ::unlink(path);
+    assert(load_column(path, loaded) == std::errc::no_such_file_or_directory);
+}
+
+int main()
+{
+    test_arithmetic<R64>();
+    test_arithmetic<R128>();
+    test_sum<R64>();
+    test_sum<R128>();
+    test_column<std::int32_t>();
+    test_column<std::int64_t>();
+    test_text<std::int32_t>();
+    test_text<std::int64_t>();
+    test_text<__int128>();
+
+    using rational_detail::binary_gcd;
+    assert(binary_gcd<std::uint64_t>(0, 0) == 0 && binary_gcd<std::uint64_t>(0, 7) == 7);
+    assert(binary_gcd<std::uint64_t>(48, 180) == 12);
+    assert(binary_gcd<std::uint64_t>(1ull << 63, 3ull << 40) == 1ull << 40);
+    assert(binary_gcd((unsigned __int128)1 << 100, (unsigned __int128)3 << 70) == (unsigned __int128)1 << 70);
+
+    // Перекрёстное сокращение: int-версия 06_01 переполнилась бы
+    // уже на произведении числителей.
+    const std::int64_t big = std::int64_t(1) << 40;
+    assert(R64(big, 3) * R64(9, big) == R64(3));
+    assert(R64(3037000499, 2) * R64(4, 3037000499) == R64(2));
+
+    // Сложение через gcd знаменателей: произведение знаменателей
+    // (3 · 2^121) не помещается в int64, а результат помещается.
+    const std::int64_t p60 = std::int64_t(1) << 60;
+    assert(R64(1, 2 * p60) + R64(1, 3 * p60) == R64(5, 6 * p60));
+
+    // Сравнение в удвоенной разрядности.
+    const std::int64_t max = std::numeric_limits<std::int64_t>::max();
+    assert(R64(max - 1, max) < R64(max, max - 2));
+    assert(R64(-(max - 1), max) > R64(-max, max - 2));
+    assert(R64(max, 3) > R64(max - 1, 3));
+
+    const __int128 huge = (__int128(1) << 120) + 1;
+    assert(R128(huge - 1, huge) > R128(huge, huge + 2));
+    assert(R128(-huge, 7) < R128(-(huge - 1), 7));
+    assert(R128(huge, huge - 4) < R128(huge - 2, huge - 6));
+    assert(R128(-1, huge) < R128(0) && R128(0) < R128(1, huge));
+
+    std::stringstream wide;
+    wide << R128(huge, 3);
+    assert(wide.str() == "1329227995784915872903807060280344577/3");
+    R128 back;
+    wide >> back;
+    assert(back == R128(huge, 3));
+}
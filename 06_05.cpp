@@ -0,0 +1,170 @@
+#include "BigRational.hpp"
+#include "RationalSum.hpp"
+
+#include <cassert>
+#include <cstdint>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// Эталонный НОД — алгоритм Евклида на делении BigInt.
+BigInt euclid(BigInt a, BigInt b)
+{
+    if (a < 0) a = -a;
+    if (b < 0) b = -b;
+    while (!b.is_zero())
+    {
+        BigInt r = a % b;
+        a = std::move(b);
+        b = std::move(r);
+    }
+    return a;
+}
+
+BigInt random_big(std::mt19937_64& rng, std::size_t limbs)
+{
+    BigInt result;
+    const BigInt base = BigInt::parse("18446744073709551616");
+    for (std::size_t i = 0; i < limbs; ++i)
+        result = result * base + BigInt(std::int64_t(rng() >> 1)) * 2 + BigInt(int(rng() & 1));
+    return rng() & 1 ? -result : result;
+}
+
+void test_small()
+{
+    // Сверка с __int128 на значениях, умещающихся в одну-две цифры.
+    std::mt19937_64 rng(42);
+    for (int i = 0; i < 10000; ++i)
+    {
+        const std::int64_t a = std::int64_t(rng()) >> (rng() % 64);
+        const std::int64_t b = (std::int64_t(rng()) >> (rng() % 64)) | 1;
+        const BigInt x = a, y = b;
+
+        assert(x + y - y == x);
+        assert(((x * y) / y) == x);
+        assert((x / y).to_int64() == a / b);
+        assert((x % y).to_int64() == a % b);
+        assert((x <=> y) == (a <=> b));
+        assert(gcd(x, y).to_int64() == std::int64_t(rational_detail::binary_gcd<std::uint64_t>(
+                                            a < 0 ? 0 - std::uint64_t(a) : a, b < 0 ? 0 - std::uint64_t(b) : b)));
+    }
+
+    assert(BigInt(INT64_MIN).fits_int64() && BigInt(INT64_MIN).to_int64() == INT64_MIN);
+    assert(!(-BigInt(INT64_MIN)).fits_int64());
+    assert(BigInt(0) == -BigInt(0) && !(-BigInt(0)).is_negative());
+    assert((BigInt(5) - BigInt(5)).sign() == 0 && (BigInt(-5) + BigInt(5)).sign() == 0);
+}
+
+void test_text()
+{
+    const std::string text = "-340282366920938463463374607431768211456"; // -2^128
+    const BigInt x = BigInt::parse(text);
+    assert(x.to_string() == text && x.limbs() == 3);
+
+    BigInt two64 = BigInt(1) + BigInt(INT64_MAX);
+    assert(-(two64 * two64 * 2) * 2 == x);
+    assert(BigInt::parse("0000").is_zero() && BigInt::parse("+10000000000000000000").to_string() == "10000000000000000000");
+
+    BigInt factorial = 1;
+    for (int i = 2; i <= 30; ++i)
+        factorial *= i;
+    assert(factorial.to_string() == "265252859812191058636308480000000");
+    assert(static_cast<double>(factorial) == 265252859812191058636308480000000.0);
+
+    std::stringstream io("123456789012345678901234567890 x");
+    BigInt y;
+    io >> y;
+    assert(y.to_string() == "123456789012345678901234567890");
+    assert(!(io >> y) && y.to_string() == "123456789012345678901234567890");
+
+    for (const char* bad : {"x12", "-", "+x1", "/5"})
+    {
+        std::stringstream in(bad);
+        BigInt z = 7;
+        assert(!(in >> z) && z == BigInt(7));
+    }
+    std::stringstream signs("-12 +34");
+    BigInt neg, pos;
+    assert((signs >> neg >> pos) && neg == BigInt(-12) && pos == BigInt(34));
+}
+
+void test_large()
+{
+    std::mt19937_64 rng(7);
+
+    // Длины по обе стороны порога Карацубы, в том числе несимметричные.
+    for (std::size_t na : {1, 5, 47, 48, 49, 64, 100, 257})
+        for (std::size_t nb : {1, 2, 40, 48, 90, 200})
+        {
+            const BigInt a = random_big(rng, na), b = random_big(rng, nb), c = random_big(rng, 17);
+
+            // (a + b)² = a² + 2ab + b², и дистрибутивность.
+            assert((a + b) * (a + b) == a * a + a * b * 2 + b * b);
+            assert(a * (b + c) == a * b + a * c);
+
+            // Деление с остатком: a = q·b + r, |r| < |b|, знак r — как у a.
+            const BigInt q = a / b, r = a % b;
+            assert(q * b + r == a);
+            assert((r < 0 ? -r : r) < (b < 0 ? -b : b));
+            assert(r.is_zero() || r.is_negative() == a.is_negative());
+            assert((a * b) / b == a && ((a * b) % b).is_zero());
+
+            // НОД Лемера против Евклида, в том числе с большим общим делителем.
+            const BigInt g = gcd(a * c, b * c);
+            assert(g == euclid(a * c, b * c));
+            assert((g % c).is_zero());
+        }
+}
+
+void test_rational()
+{
+    using R = BigRational;
+
+    R x(1), y(2, 1);
+    assert((x += y) == R(3) && (x -= y) == R(1));
+    assert((x *= y) == R(2) && (x /= y) == R(1));
+    assert(R(6, -8) == R(-3, 4) && R(6, -8).denominator() == 4);
+    assert(R(1, 3) + R(1, 6) == R(1, 2));
+    assert(R(4, 9) * R(3, 8) == R(1, 6));
+    assert(R(1, 2) < R(3, 4) && R(-1, 2) < R(1, 3));
+
+    // Гармонический ряд до 100: знаменатель далеко за пределами int64.
+    R h;
+    for (int i = 1; i <= 100; ++i)
+        h += R(1, i);
+    assert(h.denominator().limbs() > 1);
+    assert(h > R(5) && h < R(6));
+
+    std::stringstream out;
+    out << h;
+    R back;
+    out >> back;
+    assert(back == h);
+    assert(out.str().starts_with("14466636279520351160221518043104131447711/"));
+
+    // Отложенное сокращение и попарная сумма дают тот же результат.
+    std::vector<R> terms;
+    RationalSum<BigInt> acc;
+    for (int i = 1; i <= 1000; ++i)
+    {
+        terms.emplace_back(i % 3 ? 1 : -1, i);
+        acc += terms.back();
+    }
+    R expected;
+    for (const R& t : terms)
+        expected += t;
+    assert(acc.value() == expected && sum(terms) == expected);
+
+    std::stringstream in("30/-40");
+    in >> back;
+    assert(back == R(-3, 4));
+}
+
+int main()
+{
+    test_small();
+    test_text();
+    test_large();
+    test_rational();
+}
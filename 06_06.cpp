@@ -0,0 +1,202 @@
+#define INSTRUMENT_ENABLED 1
+
+#include "Instrument.hpp"
+#include "GameUnit.hpp"
+#include "ParallelAttack.hpp"
+#include "Rational.hpp"
+#include "06_02/Rational.hpp"
+#include "Sort.hpp"
+#include "Vector.hpp"
+
+#include <cassert>
+#include <cstdint>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+const instrument::MetricSnapshot& find(const std::vector<instrument::MetricSnapshot>& metrics, std::string_view name)
+{
+    for (const auto& m : metrics)
+        if (m.name == name)
+            return m;
+    assert(false);
+    return metrics.front();
+}
+
+std::uint64_t value(std::string_view name)
+{
+    return find(instrument::snapshot(), name).sum;
+}
+
+void test_counters()
+{
+    instrument::reset();
+
+    // Потоки завершаются до snapshot(): их значения переходят в итоги.
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t)
+        threads.emplace_back([]
+        {
+            for (int i = 0; i < 1000; ++i)
+                INSTRUMENT_COUNT("test.count");
+            INSTRUMENT_ADD("test.count", 500);
+        });
+    for (auto& t : threads)
+        t.join();
+
+    // То же имя из другого места — та же метрика.
+    INSTRUMENT_COUNT("test.count");
+    assert(value("test.count") == 4 * 1500 + 1);
+
+    instrument::reset();
+    assert(value("test.count") == 0);
+}
+
+void test_histogram()
+{
+    instrument::reset();
+    for (std::uint64_t v : {0, 1, 2, 3, 4, 1000})
+        INSTRUMENT_HISTOGRAM("test.histogram", v);
+
+    const auto m = find(instrument::snapshot(), "test.histogram");
+    assert(m.kind == instrument::Kind::histogram);
+    assert(m.count == 6 && m.sum == 1010);
+    assert(m.histogram[0] == 1 && m.histogram[1] == 1 && m.histogram[2] == 2 && m.histogram[3] == 1);
+    assert(m.histogram[10] == 1);
+    assert(instrument::quantile(m, 0.5) == 3);
+    assert(instrument::quantile(m, 1.0) == 1023);
+}
+
+void test_trace()
+{
+    instrument::reset();
+    instrument::start_trace();
+    {
+        INSTRUMENT_SCOPE("test.outer");
+        for (int i = 0; i < 3; ++i)
+        {
+            INSTRUMENT_SCOPE("test.inner");
+        }
+    }
+    std::thread([] { INSTRUMENT_SCOPE("test.thread"); }).join();
+    instrument::stop_trace();
+    {
+        INSTRUMENT_SCOPE("test.untraced");
+    }
+
+    const auto metrics = instrument::snapshot();
+    const auto& outer = find(metrics, "test.outer");
+    assert(outer.kind == instrument::Kind::timer && outer.count == 1);
+    assert(find(metrics, "test.inner").count == 3);
+    assert(find(metrics, "test.untraced").count == 1);
+
+    std::ostringstream os;
+    instrument::write_chrome_trace(os);
+    const std::string json = os.str();
+    assert(json.starts_with("{\"displayTimeUnit\":\"ns\",\"traceEvents\":[") && json.ends_with("]}\n"));
+    assert(json.find("{\"name\":\"test.outer\",\"ph\":\"X\",\"pid\":1,\"tid\":") != std::string::npos);
+    assert(json.find("\"name\":\"test.thread\"") != std::string::npos);
+    assert(json.find("\"name\":\"test.untraced\"") == std::string::npos);
+
+    std::size_t inner = 0;
+    for (std::size_t at = 0; (at = json.find("\"name\":\"test.inner\"", at)) != std::string::npos; ++at)
+        ++inner;
+    assert(inner == 3);
+}
+
+void test_export()
+{
+    instrument::reset();
+    INSTRUMENT_ADD("test.csv", 42);
+    INSTRUMENT_HISTOGRAM("test.histogram", 7);
+
+    std::ostringstream csv;
+    instrument::write_perf_csv(csv);
+    assert(csv.str().find("42,,test.csv\n") != std::string::npos);
+    assert(csv.str().find("7,,test.histogram\n1,,test.histogram.count\n") != std::string::npos);
+
+    std::ostringstream report;
+    instrument::write_report(report);
+    assert(report.str().find("test.csv") != std::string::npos);
+}
+
+void test_hot_paths()
+{
+    instrument::reset();
+
+    // Каждый ложный comp добавляет второе сравнение, ==.
+    std::uint64_t calls = 0, falses = 0;
+    auto less = [&](int a, int b) { ++calls; falses += !(a < b); return a < b; };
+    std::vector<int> v = {5, 3, 8, 1, 9, 2};
+    quickSort(v, 0, int(v.size()) - 1, less);
+    assert(calls > 0 && value("sort.compare") == calls + falses);
+    assert(find(instrument::snapshot(), "sort.partition").count > 0);
+
+    Vector<int> vec;
+    for (int i = 0; i < 5; ++i)
+        vec.push_back(i);
+    // Ёмкость 1, 2, 4, 8: четыре перевыделения, перенесено 0 + 1 + 2 + 4.
+    assert(value("vector.reallocate") == 4 && value("vector.moved") == 7);
+    Vector<int> copy(vec);
+    assert(value("vector.copy") == 1);
+
+    Rational<std::int64_t> r(6, 8);
+    r += Rational<std::int64_t>(1, 4);
+    assert(value("rational.gcd") >= 2);
+    const std::uint64_t gcd = value("rational.gcd");
+    task0602::Rational q(6, 8);
+    q += task0602::Rational(1, 4);
+    assert(value("rational.gcd") == gcd + 3);   // reduce(): два конструктора и +=
+
+    auto group = std::make_shared<UnitGroup>();
+    for (int i = 0; i < 3; ++i)
+        group->addUnit(std::make_shared<SingleUnit>(CharacterBuilder().setName("unit").build()));
+    group->attack();
+    assert(value("unit.attack") == 3 && find(instrument::snapshot(), "UnitGroup::attack").count == 1);
+
+    ThreadPool pool(2);
+    AttackPlan plan(*group, 1);
+    std::vector<AttackEvent> events(plan.size());
+    plan.run(pool, events);
+    assert(value("unit.collect") == 3 && value("ThreadPool.task") == plan.items());
+}
+
+void test_overflow()
+{
+    // Имена живут до конца программы: реестр хранит указатели.
+    static std::vector<std::string> names;
+    for (std::size_t i = 0; i < instrument::max_metrics; ++i)
+        names.push_back("test.many." + std::to_string(i));
+
+    instrument::reset();
+    instrument::start_trace();
+    for (const std::string& name : names)
+    {
+        const std::uint32_t id = instrument::detail::register_metric(name.c_str(), instrument::Kind::timer);
+        assert(id < instrument::max_metrics);
+        instrument::Scope scope(id);
+    }
+    instrument::stop_trace();
+
+    const auto metrics = instrument::snapshot();
+    assert(metrics.size() == instrument::max_metrics);
+    // Лишние имена попали в последнюю ячейку, и она названа.
+    const auto& overflow = find(metrics, "instrument.overflow");
+    assert(overflow.kind == instrument::Kind::counter && overflow.count > 0);
+
+    std::ostringstream os;
+    instrument::write_chrome_trace(os);
+    assert(os.str().find("\"name\":\"instrument.overflow\",\"ph\":\"X\"") != std::string::npos);
+}
+
+int main()
+{
+    test_counters();
+    test_histogram();
+    test_trace();
+    test_export();
+    test_hot_paths();
+    test_overflow();
+}
@@ -0,0 +1,168 @@
+#pragma once
+#include <cassert>
+#include <cstddef>
+#include <cstring>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+// Поведение со стёртым типом без кучи: объект лежит во встроенном
+// буфере Size байт, а функции для его типа генерируются на этапе
+// компиляции. Указатель на attack() хранится прямо в AnyBehavior — вызов
+// это одно косвенное обращение без чтения vtable; копирование,
+// перемещение и уничтожение — в общей constexpr-таблице типа.
+//
+// Смена поведения (воин подобрал лук) — уничтожение старого объекта
+// и конструирование нового в том же буфере.
+
+template <std::size_t Size = 3 * sizeof(void*), std::size_t Align = alignof(void*)>
+class AnyBehavior
+{
+public:
+    template <typename B>
+    static constexpr bool fits_v =
+        sizeof(B) <= Size && Align % alignof(B) == 0 &&
+        std::is_nothrow_move_constructible_v<B> && std::is_copy_constructible_v<B>;
+
+    AnyBehavior() = default;
+
+    template <typename B>
+        requires (!std::is_same_v<std::remove_cvref_t<B>, AnyBehavior>)
+    AnyBehavior(B&& behavior)
+    {
+        emplace<std::remove_cvref_t<B>>(std::forward<B>(behavior));
+    }
+
+    AnyBehavior(const AnyBehavior& other) { copy_from(other); }
+
+    AnyBehavior(AnyBehavior&& other) noexcept { move_from(other); }
+
+    ~AnyBehavior() { reset(); }
+
+    AnyBehavior& operator=(const AnyBehavior& other)
+    {
+        if (this != &other)
+        {
+            reset();
+            copy_from(other);
+        }
+        return *this;
+    }
+
+    AnyBehavior& operator=(AnyBehavior&& other) noexcept
+    {
+        if (this != &other)
+        {
+            reset();
+            move_from(other);
+        }
+        return *this;
+    }
+
+    template <typename B>
+        requires (!std::is_same_v<std::remove_cvref_t<B>, AnyBehavior>)
+    AnyBehavior& operator=(B&& behavior)
+    {
+        emplace<std::remove_cvref_t<B>>(std::forward<B>(behavior));
+        return *this;
+    }
+
+    // -------------------------------------------------
+
+    template <typename B, typename... Args>
+    B& emplace(Args&&... args)
+    {
+        static_assert(fits_v<B>, "Behavior does not fit into AnyBehavior's buffer");
+        reset();
+        B* behavior = ::new (static_cast<void*>(m_storage)) B(std::forward<Args>(args)...);
+        m_attack = &attack_thunk<B>;
+        m_ops = &ops<B>;
+        return *behavior;
+    }
+
+    void reset() noexcept
+    {
+        if (m_ops && m_ops->destroy)
+            m_ops->destroy(m_storage);
+        m_attack = nullptr;
+        m_ops = nullptr;
+    }
+
+    // -------------------------------------------------
+
+    void attack() const
+    {
+        assert(m_attack && "AnyBehavior is empty");
+        m_attack(m_storage);
+    }
+
+    explicit operator bool() const { return m_attack != nullptr; }
+
+    // Тип определяется по адресу его таблицы, без RTTI.
+    template <typename B>
+    bool holds() const { return m_ops == &ops<B>; }
+
+    template <typename B>
+    B* get_if() { return holds<B>() ? std::launder(reinterpret_cast<B*>(m_storage)) : nullptr; }
+
+    template <typename B>
+    const B* get_if() const { return holds<B>() ? std::launder(reinterpret_cast<const B*>(m_storage)) : nullptr; }
+
+private:
+    // Редкие операции — в общей для типа таблице. Для тривиально
+    // копируемых типов таблица пуста: буфер копируется целиком.
+    struct Ops
+    {
+        void (*copy)(void*, const void*) = nullptr;
+        void (*move)(void*, void*) noexcept = nullptr;
+        void (*destroy)(void*) noexcept = nullptr;
+    };
+
+    template <typename B>
+    static void attack_thunk(const void* self) { static_cast<const B*>(self)->attack(); }
+
+    template <typename B>
+    static constexpr Ops make_ops()
+    {
+        if constexpr (std::is_trivially_copyable_v<B>)
+            return {};
+        else
+            return {
+                [](void* to, const void* from) { ::new (to) B(*static_cast<const B*>(from)); },
+                [](void* to, void* from) noexcept
+                {
+                    ::new (to) B(std::move(*static_cast<B*>(from)));
+                    static_cast<B*>(from)->~B();
+                },
+                [](void* self) noexcept { static_cast<B*>(self)->~B(); },
+            };
+    }
+
+    template <typename B>
+    static constexpr Ops ops = make_ops<B>();
+
+    void copy_from(const AnyBehavior& other)
+    {
+        if (other.m_ops && other.m_ops->copy)
+            other.m_ops->copy(m_storage, other.m_storage);
+        else
+            std::memcpy(m_storage, other.m_storage, Size);
+        m_attack = other.m_attack;
+        m_ops = other.m_ops;
+    }
+
+    // Источник после перемещения пуст: его объект уже уничтожен.
+    void move_from(AnyBehavior& other) noexcept
+    {
+        if (other.m_ops && other.m_ops->move)
+            other.m_ops->move(m_storage, other.m_storage);
+        else
+            std::memcpy(m_storage, other.m_storage, Size);
+        m_attack = std::exchange(other.m_attack, nullptr);
+        m_ops = std::exchange(other.m_ops, nullptr);
+    }
+
+    void (*m_attack)(const void*) = nullptr;
+    const Ops* m_ops = nullptr;
+    alignas(Align) std::byte m_storage[Size];
+};
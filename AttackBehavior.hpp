@@ -0,0 +1,167 @@
+#pragma once
+#include "Instrument.hpp"
+#include "RingBuffer.hpp"
+
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <utility>
+
+// Шаблонный метод атаки в двух вариантах.
+//
+// AttackPipeline<Prepare, Attack, Finish> — фазы заданы политиками на этапе
+// компиляции, perform(sink) встраивает все три в одну функцию без
+// виртуальных вызовов. Фаза не печатает, а отдаёт запись AttackRecord
+// приёмнику: NullSink (ничего не делает), RingSink (кольцевой буфер без
+// блокировок, читатель забирает записи сам) или StreamSink (печать
+// в поток, как раньше).
+//
+// AttackBehavior — прежний виртуальный интерфейс; PipelineAttack
+// реализует его поверх любого конвейера и приёмника.
+
+enum class AttackPhase : std::uint8_t
+{
+    Prepare,
+    Attack,
+    Finish,
+};
+
+// Текст — строковый литерал политики, запись не владеет памятью.
+struct AttackRecord
+{
+    AttackPhase phase = AttackPhase::Prepare;
+    const char* text = "";
+};
+
+template <typename S>
+concept AttackSink = requires(S& sink, const AttackRecord& record)
+{
+    sink.push(record);
+};
+
+struct NullSink
+{
+    void push(const AttackRecord&) {}
+};
+
+class StreamSink
+{
+public:
+    explicit StreamSink(std::ostream& os = std::cout) : m_os(&os) {}
+
+    void push(const AttackRecord& record) { *m_os << record.text << '\n'; }
+
+private:
+    std::ostream* m_os;
+};
+
+// Запись в кольцевой буфер; если читатель отстал, запись теряется
+// и учитывается в dropped().
+template <std::size_t Capacity>
+class RingSink
+{
+public:
+    explicit RingSink(RingBuffer<AttackRecord, Capacity>& ring) : m_ring(&ring) {}
+
+    void push(const AttackRecord& record)
+    {
+        if (!m_ring->try_push(record))
+            ++m_dropped;
+    }
+
+    std::size_t dropped() const { return m_dropped; }
+
+private:
+    RingBuffer<AttackRecord, Capacity>* m_ring;
+    std::size_t m_dropped = 0;
+};
+
+//////////////////////////////////////////////////////////////////
+
+// Политика фазы: тип со статическим run(sink).
+template <AttackPhase Phase, const char* Text>
+struct Emit
+{
+    template <AttackSink Sink>
+    static void run(Sink& sink) { sink.push({Phase, Text}); }
+};
+
+inline constexpr char prepare_text[]  = "Preparing attack...";
+inline constexpr char finish_text[]   = "Attack finished.";
+inline constexpr char sword_text[]    = "Swinging sword!";
+inline constexpr char fireball_text[] = "Casting fireball!";
+
+using DefaultPrepare = Emit<AttackPhase::Prepare, prepare_text>;
+using DefaultFinish  = Emit<AttackPhase::Finish, finish_text>;
+using SwordStrike    = Emit<AttackPhase::Attack, sword_text>;
+using Fireball       = Emit<AttackPhase::Attack, fireball_text>;
+
+template <typename Prepare, typename Attack, typename Finish = DefaultFinish>
+struct AttackPipeline
+{
+    template <AttackSink Sink>
+    static void prepare(Sink& sink) { Prepare::run(sink); }
+
+    template <AttackSink Sink>
+    static void attack(Sink& sink) { Attack::run(sink); }
+
+    template <AttackSink Sink>
+    static void finish(Sink& sink) { Finish::run(sink); }
+
+    template <AttackSink Sink>
+    static void perform(Sink& sink)
+    {
+        prepare(sink);
+        attack(sink);
+        finish(sink);
+    }
+};
+
+using SwordPipeline = AttackPipeline<DefaultPrepare, SwordStrike>;
+using MagicPipeline = AttackPipeline<DefaultPrepare, Fireball>;
+
+//////////////////////////////////////////////////////////////////
+
+class AttackBehavior
+{
+public:
+    virtual ~AttackBehavior() = default;
+
+    void performAttack()
+    {
+        INSTRUMENT_SCOPE("AttackBehavior::performAttack");
+        prepare();
+        attack();
+        finish();
+    }
+
+protected:
+    virtual void prepare() { std::cout << "Preparing attack...\n"; }
+    virtual void attack() = 0;
+    virtual void finish() { std::cout << "Attack finished.\n"; }
+};
+
+// Виртуальный интерфейс поверх конвейера. Sink может быть ссылкой
+// (PipelineAttack<P, RingSink<N>&>), тогда приёмник общий.
+template <typename Pipeline, typename Sink = StreamSink>
+class PipelineAttack : public AttackBehavior
+{
+public:
+    template <typename... Args>
+        requires std::constructible_from<Sink, Args...>
+    explicit PipelineAttack(Args&&... args) : m_sink(std::forward<Args>(args)...) {}
+
+    Sink& sink() { return m_sink; }
+
+protected:
+    void prepare() override { Pipeline::prepare(m_sink); }
+    void attack()  override { Pipeline::attack(m_sink); }
+    void finish()  override { Pipeline::finish(m_sink); }
+
+private:
+    Sink m_sink;
+};
+
+class SwordAttack : public PipelineAttack<SwordPipeline> {};
+class MagicAttack : public PipelineAttack<MagicPipeline> {};
@@ -0,0 +1,758 @@
+#pragma once
+#include <algorithm>
+#include <cassert>
+#include <cctype>
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <istream>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+// Целое произвольной длины: знак и модуль — массив 64-битных «цифр»
+// (limbs) от младшей к старшей. Модуль до 2^64 хранится прямо в объекте,
+// куча нужна только для больших чисел.
+//
+// Умножение — столбиком, а начиная с karatsuba_threshold цифр у обоих
+// сомножителей — по Карацубе. Деление — алгоритм D Кнута (т. 2, 4.3.1).
+// НОД — алгоритм Лемера: пока числа длинные, шаги Евклида выполняются
+// над старшими 62 битами, и к полным числам применяется сразу их
+// произведение (матрица 2×2 с одноразрядными коэффициентами);
+// оставшиеся 64-битные значения — двоичным алгоритмом.
+
+class BigInt
+{
+public:
+    using Limb = std::uint64_t;
+
+    static constexpr std::size_t karatsuba_threshold = 48;
+
+    BigInt() = default;
+
+    BigInt(std::int64_t value) : m_negative(value < 0)
+    {
+        if (value != 0)
+            m_mag.push_back(value < 0 ? Limb(0) - Limb(value) : Limb(value));
+    }
+
+    BigInt(int value) : BigInt(std::int64_t(value)) {}
+
+    // Десятичная запись с необязательным знаком; assert на прочие символы.
+    static BigInt parse(std::string_view text)
+    {
+        BigInt result;
+        bool negative = false;
+        if (!text.empty() && (text[0] == '-' || text[0] == '+'))
+        {
+            negative = text[0] == '-';
+            text.remove_prefix(1);
+        }
+        assert(!text.empty());
+
+        // Кусками по 19 цифр: result = result * 10^k + кусок.
+        std::size_t head = text.size() % 19 ? text.size() % 19 : 19;
+        while (!text.empty())
+        {
+            Limb chunk = 0, scale = 1;
+            for (char c : text.substr(0, head))
+            {
+                assert(c >= '0' && c <= '9');
+                chunk = chunk * 10 + Limb(c - '0');
+                scale *= 10;
+            }
+            mul_add_small(result.m_mag, scale, chunk);
+            text.remove_prefix(head);
+            head = 19;
+        }
+
+        result.m_negative = negative && !result.is_zero();
+        return result;
+    }
+
+    std::string to_string() const
+    {
+        if (is_zero())
+            return "0";
+
+        // Остатки от деления на 10^19, от младших к старшим.
+        Limbs rest = m_mag;
+        std::vector<Limb> chunks;
+        while (rest.size() != 0)
+            chunks.push_back(div_small(rest, 10000000000000000000ull));
+
+        std::string result = m_negative ? "-" : "";
+        result += std::to_string(chunks.back());
+        for (std::size_t i = chunks.size() - 1; i-- > 0;)
+        {
+            std::string digits = std::to_string(chunks[i]);
+            result.append(19 - digits.size(), '0');
+            result += digits;
+        }
+        return result;
+    }
+
+    // -------------------------------------------------
+
+    bool is_zero()     const { return m_mag.size() == 0; }
+    bool is_negative() const { return m_negative; }
+    int  sign()        const { return is_zero() ? 0 : m_negative ? -1 : 1; }
+
+    // Число 64-битных цифр модуля.
+    std::size_t limbs() const { return m_mag.size(); }
+
+    bool fits_int64() const
+    {
+        if (m_mag.size() > 1)
+            return false;
+        const Limb value = m_mag.size() ? m_mag[0] : 0;
+        return m_negative ? value <= (Limb(1) << 63) : value < (Limb(1) << 63);
+    }
+
+    std::int64_t to_int64() const
+    {
+        assert(fits_int64());
+        const Limb value = m_mag.size() ? m_mag[0] : 0;
+        return m_negative ? std::int64_t(Limb(0) - value) : std::int64_t(value);
+    }
+
+    explicit operator double() const
+    {
+        double result = 0;
+        for (std::size_t i = m_mag.size(); i-- > 0;)
+            result = result * 18446744073709551616.0 + double(m_mag[i]);
+        return m_negative ? -result : result;
+    }
+
+    // -------------------------------------------------
+
+    BigInt operator-() const
+    {
+        BigInt result = *this;
+        result.m_negative = !m_negative && !is_zero();
+        return result;
+    }
+
+    BigInt& operator+=(const BigInt& other) { return add(other, other.m_negative); }
+    BigInt& operator-=(const BigInt& other) { return add(other, !other.m_negative); }
+
+    BigInt& operator*=(const BigInt& other)
+    {
+        const bool negative = m_negative != other.m_negative;
+        if (m_mag.size() <= 1 && other.m_mag.size() <= 1)
+        {
+            const unsigned __int128 product =
+                (unsigned __int128)(m_mag.size() ? m_mag[0] : 0) * (other.m_mag.size() ? other.m_mag[0] : 0);
+            set_wide(product);
+        }
+        else
+            m_mag = mul(m_mag, other.m_mag);
+
+        m_negative = negative && !is_zero();
+        return *this;
+    }
+
+    // Деление с отбрасыванием дробной части, как у встроенных целых.
+    BigInt& operator/=(const BigInt& other)
+    {
+        const bool negative = m_negative != other.m_negative;
+        Limbs remainder;
+        m_mag = divmod(m_mag, other.m_mag, remainder);
+        m_negative = negative && !is_zero();
+        return *this;
+    }
+
+    BigInt& operator%=(const BigInt& other)
+    {
+        Limbs remainder;
+        divmod(m_mag, other.m_mag, remainder);
+        m_mag = std::move(remainder);
+        m_negative = m_negative && !is_zero();
+        return *this;
+    }
+
+    friend BigInt operator+(BigInt lhs, const BigInt& rhs) { return lhs += rhs; }
+    friend BigInt operator-(BigInt lhs, const BigInt& rhs) { return lhs -= rhs; }
+    friend BigInt operator*(BigInt lhs, const BigInt& rhs) { return lhs *= rhs; }
+    friend BigInt operator/(BigInt lhs, const BigInt& rhs) { return lhs /= rhs; }
+    friend BigInt operator%(BigInt lhs, const BigInt& rhs) { return lhs %= rhs; }
+
+    // -------------------------------------------------
+
+    friend bool operator==(const BigInt& lhs, const BigInt& rhs)
+    {
+        return lhs.m_negative == rhs.m_negative && compare(lhs.m_mag, rhs.m_mag) == 0;
+    }
+
+    friend std::strong_ordering operator<=>(const BigInt& lhs, const BigInt& rhs)
+    {
+        if (lhs.m_negative != rhs.m_negative)
+            return rhs.m_negative <=> lhs.m_negative;
+
+        const int c = compare(lhs.m_mag, rhs.m_mag);
+        return lhs.m_negative ? 0 <=> c : c <=> 0;
+    }
+
+    // Неотрицательный НОД; gcd(0, 0) == 0.
+    friend BigInt gcd(const BigInt& a, const BigInt& b)
+    {
+        BigInt result;
+        result.m_mag = lehmer_gcd(a.m_mag, b.m_mag);
+        return result;
+    }
+
+    friend std::ostream& operator<<(std::ostream& os, const BigInt& value)
+    {
+        return os << value.to_string();
+    }
+
+    friend std::istream& operator>>(std::istream& is, BigInt& value)
+    {
+        char c;
+        if (!(is >> c))
+            return is;
+
+        // [+-]?цифры; иначе failbit, и value не меняется.
+        const bool sign = c == '+' || c == '-';
+        if (!sign && !std::isdigit(static_cast<unsigned char>(c)))
+        {
+            is.setstate(std::ios::failbit);
+            return is;
+        }
+
+        std::string text(1, c);
+        while (std::isdigit(is.peek()))
+            text += char(is.get());
+
+        if (sign && text.size() == 1)
+            is.setstate(std::ios::failbit);
+        else
+            value = parse(text);
+        return is;
+    }
+
+private:
+    // Массив цифр со встроенным местом под одну цифру.
+    class Limbs
+    {
+    public:
+        Limbs() = default;
+
+        Limbs(const Limbs& other) { assign(other.m_data, other.m_size); }
+
+        Limbs(Limbs&& other) noexcept { steal(other); }
+
+        Limbs& operator=(const Limbs& other)
+        {
+            if (this != &other)
+                assign(other.m_data, other.m_size);
+            return *this;
+        }
+
+        Limbs& operator=(Limbs&& other) noexcept
+        {
+            if (this != &other)
+            {
+                release();
+                steal(other);
+            }
+            return *this;
+        }
+
+        ~Limbs() { release(); }
+
+        std::size_t size() const { return m_size; }
+        Limb*       data()       { return m_data; }
+        const Limb* data() const { return m_data; }
+
+        Limb&       operator[](std::size_t i)       { return m_data[i]; }
+        const Limb& operator[](std::size_t i) const { return m_data[i]; }
+
+        // Новые цифры заполняются нулями.
+        void resize(std::size_t size)
+        {
+            reserve(size);
+            std::fill(m_data + std::min<std::size_t>(m_size, size), m_data + size, Limb(0));
+            m_size = static_cast<std::uint32_t>(size);
+        }
+
+        void push_back(Limb limb)
+        {
+            reserve(m_size + 1);
+            m_data[m_size++] = limb;
+        }
+
+        // Отбрасывает старшие нулевые цифры.
+        void trim()
+        {
+            while (m_size != 0 && m_data[m_size - 1] == 0)
+                --m_size;
+        }
+
+        void assign(const Limb* data, std::size_t size)
+        {
+            m_size = 0;
+            reserve(size);
+            std::copy(data, data + size, m_data);
+            m_size = static_cast<std::uint32_t>(size);
+        }
+
+    private:
+        void reserve(std::size_t capacity)
+        {
+            if (capacity <= m_capacity)
+                return;
+
+            const std::size_t grown = std::max<std::size_t>(capacity, 2 * m_capacity);
+            Limb* data = new Limb[grown];
+            std::copy(m_data, m_data + m_size, data);
+            release();
+            m_data = data;
+            m_capacity = static_cast<std::uint32_t>(grown);
+        }
+
+        void release()
+        {
+            if (m_data != m_local)
+                delete[] m_data;
+            m_data = m_local;
+            m_capacity = 1;
+        }
+
+        void steal(Limbs& other)
+        {
+            m_size = other.m_size;
+            if (other.m_data == other.m_local)
+            {
+                m_local[0] = other.m_local[0];
+                m_data = m_local;
+                m_capacity = 1;
+            }
+            else
+            {
+                m_data = other.m_data;
+                m_capacity = other.m_capacity;
+                other.m_data = other.m_local;
+                other.m_capacity = 1;
+            }
+            other.m_size = 0;
+        }
+
+        Limb* m_data = m_local;
+        std::uint32_t m_size = 0;
+        std::uint32_t m_capacity = 1;
+        Limb m_local[1] = {};
+    };
+
+    using u128 = unsigned __int128;
+
+    void set_wide(u128 value)
+    {
+        m_mag.resize(0);
+        if (value != 0)
+            m_mag.push_back(Limb(value));
+        if (value >> 64)
+            m_mag.push_back(Limb(value >> 64));
+    }
+
+    // *this += (negate ? -other : other)
+    BigInt& add(const BigInt& other, bool negative)
+    {
+        if (other.is_zero())
+            return *this;
+
+        if (is_zero() || m_negative == negative)
+        {
+            add_mag(m_mag, other.m_mag);
+            m_negative = negative;
+            return *this;
+        }
+
+        // Разные знаки: из большего модуля вычитается меньший.
+        if (compare(m_mag, other.m_mag) >= 0)
+            sub_mag(m_mag, other.m_mag);
+        else
+        {
+            Limbs mag = other.m_mag;
+            sub_mag(mag, m_mag);
+            m_mag = std::move(mag);
+            m_negative = negative;
+        }
+        if (is_zero())
+            m_negative = false;
+        return *this;
+    }
+
+    // -------------------------------------------------
+    // Операции над модулями.
+
+    static int compare(const Limbs& a, const Limbs& b)
+    {
+        return compare(a.data(), a.size(), b.data(), b.size());
+    }
+
+    static int compare(const Limb* a, std::size_t na, const Limb* b, std::size_t nb)
+    {
+        while (na && a[na - 1] == 0) --na;
+        while (nb && b[nb - 1] == 0) --nb;
+        if (na != nb)
+            return na < nb ? -1 : 1;
+        for (std::size_t i = na; i-- > 0;)
+            if (a[i] != b[i])
+                return a[i] < b[i] ? -1 : 1;
+        return 0;
+    }
+
+    // r[0, n) += a[0, na), na <= n; возвращает перенос из r[n - 1].
+    static Limb add_into(Limb* r, std::size_t n, const Limb* a, std::size_t na)
+    {
+        Limb carry = 0;
+        std::size_t i = 0;
+        for (; i < na; ++i)
+        {
+            const u128 sum = u128(r[i]) + a[i] + carry;
+            r[i] = Limb(sum);
+            carry = Limb(sum >> 64);
+        }
+        for (; carry && i < n; ++i)
+            carry = ++r[i] == 0;
+        return carry;
+    }
+
+    // r[0, n) -= a[0, na), na <= n; возвращает заём.
+    static Limb sub_into(Limb* r, std::size_t n, const Limb* a, std::size_t na)
+    {
+        Limb borrow = 0;
+        std::size_t i = 0;
+        for (; i < na; ++i)
+        {
+            const Limb x = r[i], y = a[i];
+            const Limb d = x - y - borrow;
+            borrow = (x < y) | ((x == y) & borrow);
+            r[i] = d;
+        }
+        for (; borrow && i < n; ++i)
+            borrow = r[i]-- == 0;
+        return borrow;
+    }
+
+    static void add_mag(Limbs& a, const Limbs& b)
+    {
+        const std::size_t n = std::max(a.size(), b.size());
+        a.resize(n);
+        if (add_into(a.data(), n, b.data(), b.size()))
+            a.push_back(1);
+    }
+
+    // a -= b при |a| >= |b|.
+    static void sub_mag(Limbs& a, const Limbs& b)
+    {
+        [[maybe_unused]] const Limb borrow = sub_into(a.data(), a.size(), b.data(), b.size());
+        assert(borrow == 0);
+        a.trim();
+    }
+
+    // a = a * m + add
+    static void mul_add_small(Limbs& a, Limb m, Limb add)
+    {
+        Limb carry = add;
+        for (std::size_t i = 0; i < a.size(); ++i)
+        {
+            const u128 t = u128(a[i]) * m + carry;
+            a[i] = Limb(t);
+            carry = Limb(t >> 64);
+        }
+        if (carry)
+            a.push_back(carry);
+    }
+
+    // a /= d, возвращает остаток.
+    static Limb div_small(Limbs& a, Limb d)
+    {
+        assert(d != 0);
+        u128 rest = 0;
+        for (std::size_t i = a.size(); i-- > 0;)
+        {
+            const u128 cur = (rest << 64) | a[i];
+            a[i] = Limb(cur / d);
+            rest = cur % d;
+        }
+        a.trim();
+        return Limb(rest);
+    }
+
+    // r[0, na + nb) = a * b столбиком.
+    static void mul_school(Limb* r, const Limb* a, std::size_t na, const Limb* b, std::size_t nb)
+    {
+        std::fill(r, r + na + nb, Limb(0));
+        for (std::size_t i = 0; i < na; ++i)
+        {
+            Limb carry = 0;
+            for (std::size_t j = 0; j < nb; ++j)
+            {
+                const u128 t = u128(a[i]) * b[j] + r[i + j] + carry;
+                r[i + j] = Limb(t);
+                carry = Limb(t >> 64);
+            }
+            r[i + nb] = carry;
+        }
+    }
+
+    // r[0, na + nb) = a * b, na >= nb.
+    static void mul_karatsuba(Limb* r, const Limb* a, std::size_t na, const Limb* b, std::size_t nb)
+    {
+        if (nb < karatsuba_threshold)
+        {
+            mul_school(r, a, na, b, nb);
+            return;
+        }
+
+        // Сильно несимметричные множители — по кускам длины nb.
+        if (2 * nb <= na)
+        {
+            std::fill(r, r + na + nb, Limb(0));
+            std::vector<Limb> part(2 * nb);
+            for (std::size_t at = 0; at < na; at += nb)
+            {
+                const std::size_t len = std::min(nb, na - at);
+                if (len >= nb)
+                    mul_karatsuba(part.data(), a + at, len, b, nb);
+                else
+                    mul_karatsuba(part.data(), b, nb, a + at, len);
+                add_into(r + at, na + nb - at, part.data(), len + nb);
+            }
+            return;
+        }
+
+        // a = a1·B^m + a0, b = b1·B^m + b0;
+        // a·b = z2·B^2m + (z1 - z2 - z0)·B^m + z0, z1 = (a0 + a1)(b0 + b1).
+        const std::size_t m = na / 2;
+        const Limb* a0 = a;     const std::size_t na0 = m, na1 = na - m;
+        const Limb* a1 = a + m;
+        const Limb* b0 = b;     const std::size_t nb0 = std::min(m, nb), nb1 = nb - nb0;
+        const Limb* b1 = b + nb0;
+
+        std::fill(r, r + na + nb, Limb(0));
+        mul_karatsuba(r, a0, na0, b0, nb0);                      // z0 → r[0, 2m)
+        if (nb1)
+            mul_karatsuba(r + 2 * m, a1, na1, b1, nb1);         // z2 → r[2m, ...)
+
+        std::vector<Limb> sa(na1 + 1, 0), sb(std::max(nb0, nb1) + 1, 0);
+        std::copy(a1, a1 + na1, sa.begin());
+        add_into(sa.data(), sa.size(), a0, na0);
+        std::copy(b0, b0 + nb0, sb.begin());
+        add_into(sb.data(), sb.size(), b1, nb1);
+
+        std::vector<Limb> z1(sa.size() + sb.size());
+        if (sa.size() >= sb.size())
+            mul_karatsuba(z1.data(), sa.data(), sa.size(), sb.data(), sb.size());
+        else
+            mul_karatsuba(z1.data(), sb.data(), sb.size(), sa.data(), sa.size());
+
+        sub_into(z1.data(), z1.size(), r, na0 + nb0);
+        if (nb1)
+            sub_into(z1.data(), z1.size(), r + 2 * m, na1 + nb1);
+
+        std::size_t nz = z1.size();
+        while (nz && z1[nz - 1] == 0) --nz;
+        add_into(r + m, na + nb - m, z1.data(), nz);
+    }
+
+    static Limbs mul(const Limbs& a, const Limbs& b)
+    {
+        Limbs result;
+        if (a.size() == 0 || b.size() == 0)
+            return result;
+
+        result.resize(a.size() + b.size());
+        if (a.size() >= b.size())
+            mul_karatsuba(result.data(), a.data(), a.size(), b.data(), b.size());
+        else
+            mul_karatsuba(result.data(), b.data(), b.size(), a.data(), a.size());
+        result.trim();
+        return result;
+    }
+
+    // Частное u / v и остаток (алгоритм D Кнута).
+    static Limbs divmod(const Limbs& u, const Limbs& v, Limbs& remainder)
+    {
+        assert(v.size() != 0 && "BigInt division by zero");
+
+        Limbs quotient;
+        if (compare(u, v) < 0)
+        {
+            remainder = u;
+            return quotient;
+        }
+
+        if (v.size() == 1)
+        {
+            quotient = u;
+            const Limb rest = div_small(quotient, v[0]);
+            remainder.resize(0);
+            if (rest)
+                remainder.push_back(rest);
+            return quotient;
+        }
+
+        // Нормализация: старший бит делителя — единица.
+        const int s = __builtin_clzll(v[v.size() - 1]);
+        const std::size_t n = v.size(), m = u.size() - n;
+
+        std::vector<Limb> vn(n), un(u.size() + 1);
+        for (std::size_t i = n; i-- > 0;)
+            vn[i] = (v[i] << s) | (s && i ? v[i - 1] >> (64 - s) : 0);
+        un[u.size()] = s ? u[u.size() - 1] >> (64 - s) : 0;
+        for (std::size_t i = u.size(); i-- > 0;)
+            un[i] = (u[i] << s) | (s && i ? u[i - 1] >> (64 - s) : 0);
+
+        quotient.resize(m + 1);
+        for (std::size_t j = m + 1; j-- > 0;)
+        {
+            // Оценка цифры частного по двум старшим цифрам остатка.
+            const u128 top = (u128(un[j + n]) << 64) | un[j + n - 1];
+            u128 qhat = top / vn[n - 1];
+            u128 rhat = top % vn[n - 1];
+            while (qhat >> 64 || qhat * vn[n - 2] > ((rhat << 64) | un[j + n - 2]))
+            {
+                --qhat;
+                rhat += vn[n - 1];
+                if (rhat >> 64)
+                    break;
+            }
+
+            // un[j, j + n] -= qhat * vn
+            Limb borrow = 0, carry = 0;
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                const u128 p = qhat * vn[i] + carry;
+                carry = Limb(p >> 64);
+                const Limb sub = Limb(p);
+                const Limb x = un[i + j];
+                un[i + j] = x - sub - borrow;
+                borrow = (x < sub) | ((x == sub) & borrow);
+            }
+            const Limb x = un[j + n];
+            un[j + n] = x - carry - borrow;
+            const bool negative = x < carry || (x == carry && borrow);
+
+            // Оценка оказалась на единицу больше — вернуть делитель.
+            if (negative)
+            {
+                --qhat;
+                add_into(un.data() + j, n + 1, vn.data(), n);
+            }
+            quotient[j] = Limb(qhat);
+        }
+        quotient.trim();
+
+        remainder.resize(n);
+        for (std::size_t i = 0; i < n; ++i)
+            remainder[i] = (un[i] >> s) | (s ? un[i + 1] << (64 - s) : 0);
+        remainder.trim();
+        return quotient;
+    }
+
+    // Старшие 62 бита x, выровненные по длине x в битах (общий
+    // сдвиг shift применяется и к y, чтобы отношение сохранилось).
+    static Limb top_bits(const Limbs& x, std::size_t shift)
+    {
+        const std::size_t limb = shift / 64, bit = shift % 64;
+        if (limb >= x.size())
+            return 0;
+        u128 window = x[limb];
+        if (limb + 1 < x.size())
+            window |= u128(x[limb + 1]) << 64;
+        return Limb(window >> bit) & ((Limb(1) << 62) - 1);
+    }
+
+    static std::size_t bit_length(const Limbs& x)
+    {
+        return x.size() ? 64 * x.size() - __builtin_clzll(x[x.size() - 1]) : 0;
+    }
+
+    // a·x - b·y при a, b >= 0 и неотрицательном результате.
+    static Limbs combine(const Limbs& x, Limb a, const Limbs& y, Limb b)
+    {
+        Limbs ax = x, by = y;
+        mul_add_small(ax, a, 0);
+        mul_add_small(by, b, 0);
+        ax.trim();
+        by.trim();
+        sub_mag(ax, by);
+        return ax;
+    }
+
+    static Limbs lehmer_gcd(Limbs x, Limbs y)
+    {
+        if (compare(x, y) < 0)
+            std::swap(x, y);
+
+        while (y.size() > 1)
+        {
+            const std::size_t shift = bit_length(x) > 62 ? bit_length(x) - 62 : 0;
+            std::int64_t xh = std::int64_t(top_bits(x, shift));
+            std::int64_t yh = std::int64_t(top_bits(y, shift));
+
+            // Алгоритм L Кнута: шаги Евклида над старшими битами, пока
+            // частное однозначно определяется ими.
+            std::int64_t A = 1, B = 0, C = 0, D = 1;
+            while (yh + C != 0 && yh + D != 0)
+            {
+                const std::int64_t q = (xh + A) / (yh + C);
+                if (q != (xh + B) / (yh + D))
+                    break;
+
+                std::int64_t t = A - q * C; A = C; C = t;
+                t = B - q * D; B = D; D = t;
+                t = xh - q * yh; xh = yh; yh = t;
+            }
+
+            if (B == 0)
+            {
+                // Старших битов не хватило — один полный шаг Евклида.
+                Limbs remainder;
+                divmod(x, y, remainder);
+                x = std::move(y);
+                y = std::move(remainder);
+                continue;
+            }
+
+            // (x, y) ← (A·x + B·y, C·x + D·y); в каждой паре знаки разные.
+            Limbs nx = B <= 0 ? combine(x, Limb(A), y, Limb(-B)) : combine(y, Limb(B), x, Limb(-A));
+            Limbs ny = D <= 0 ? combine(x, Limb(C), y, Limb(-D)) : combine(y, Limb(D), x, Limb(-C));
+            x = std::move(nx);
+            y = std::move(ny);
+        }
+
+        if (y.size() == 0)
+            return x;
+
+        // Остаток умещается в одну цифру: x mod y и двоичный НОД.
+        Limbs rest = x;
+        Limb r = div_small(rest, y[0]);
+        Limb g = y[0];
+        if (r != 0)
+        {
+            const int shift = __builtin_ctzll(r | g);
+            r >>= __builtin_ctzll(r);
+            do
+            {
+                g >>= __builtin_ctzll(g);
+                const Limb low = r < g ? r : g;
+                g = (r < g ? g : r) - low;
+                r = low;
+            } while (g != 0);
+            g = r << shift;
+        }
+
+        Limbs result;
+        result.push_back(g);
+        return result;
+    }
+
+    Limbs m_mag;
+    bool m_negative = false;
+};
@@ -0,0 +1,18 @@
+#pragma once
+#include "BigInt.hpp"
+#include "Rational.hpp"
+
+// Рациональное число без переполнения: Rational над BigInt. Операторы
+// те же (+=, <=>, <<, >>), сокращение — через НОД Лемера из BigInt,
+// произведения в <=> точны сами по себе. Пока числитель и знаменатель
+// умещаются в 64 бита, память из кучи не выделяется.
+
+template <>
+struct rational_detail::Traits<BigInt>
+{
+    using Unsigned = BigInt;
+    using Wide = BigInt;
+    static constexpr bool bounded = false;
+};
+
+using BigRational = Rational<BigInt>;
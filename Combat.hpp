@@ -0,0 +1,159 @@
+#pragma once
+#include <algorithm>
+#include <cassert>
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+// Пакетное разрешение боя над столбцами здоровья и силы атаки
+// (например, World::healths() и World::attack_powers()): пары
+// (атакующий, цель) задаются номерами слотов. Урон всех ударов по цели
+// сначала суммируется (с насыщением), затем здоровье уменьшается
+// до нуля не ниже, а номера погибших в этом пакете слотов собираются
+// в плотный список.
+//
+// Если пакет сравним по размеру со столбцом, урон вычитается одним
+// проходом по всему столбцу без ветвлений — компилятор векторизует
+// его (-O2 и выше); маленькие пакеты применяются удар за ударом.
+
+class CombatEngine
+{
+public:
+    using Slot = std::uint32_t;
+
+    struct Hit
+    {
+        Slot attacker;
+        Slot target;
+    };
+
+    // Возвращает слоты, здоровье которых в этом пакете упало до нуля,
+    // по возрастанию (плотный проход) или в порядке гибели.
+    // Список действителен до следующего вызова resolve().
+    std::span<const Slot> resolve(std::span<int> health,
+                                  std::span<const int> attack,
+                                  std::span<const Hit> hits)
+    {
+        assert(health.size() == attack.size());
+        assert(health.size() <= UINT32_MAX);
+
+        const std::size_t units = health.size();
+        m_dead.clear();
+
+        if (hits.size() * 8 < units)
+            apply_direct(health, attack, hits);
+        else
+        {
+            if (m_damage.size() < units)
+                m_damage.resize(units, 0);
+            accumulate(attack, hits);
+            apply_dense(health);
+        }
+        return m_dead;
+    }
+
+private:
+    static constexpr std::size_t block = 256;
+    static constexpr std::size_t prefetch_distance = 16;
+
+    // Общее правило обоих путей: урон (неотрицательный) снимает здоровье
+    // не ниже нуля, а уже неположительное здоровье не меняется. Вычитается
+    // не больше max(before, 0), так что переполнения нет.
+    static int remaining(int before, int damage)
+    {
+        return before - std::min(damage, std::max(before, 0));
+    }
+
+    // Удар за ударом прямо по столбцу здоровья. Урон неотрицателен,
+    // поэтому последовательное вычитание до нуля даёт тот же результат,
+    // что и вычитание суммы.
+    void apply_direct(std::span<int> health, std::span<const int> attack, std::span<const Hit> hits)
+    {
+        for (std::size_t i = 0; i < hits.size(); ++i)
+        {
+            const Hit& hit = hits[i];
+            assert(hit.attacker < attack.size() && hit.target < attack.size());
+            prefetch(health.data(), attack, hits, i);
+
+            const int before = health[hit.target];
+            const int after = remaining(before, std::max(attack[hit.attacker], 0));
+            health[hit.target] = after;
+            if (before > 0 && after == 0)
+                m_dead.push_back(hit.target);
+        }
+    }
+
+    void accumulate(std::span<const int> attack, std::span<const Hit> hits)
+    {
+        int* damage = m_damage.data();
+        for (std::size_t i = 0; i < hits.size(); ++i)
+        {
+            const Hit& hit = hits[i];
+            assert(hit.attacker < attack.size() && hit.target < attack.size());
+            prefetch(damage, attack, hits, i);
+
+            int sum;
+            int& total = damage[hit.target];
+            total = __builtin_add_overflow(total, std::max(attack[hit.attacker], 0), &sum) ? INT_MAX : sum;
+        }
+    }
+
+    // Обращения по слотам случайны: строки кэша для удара
+    // на prefetch_distance вперёд запрашиваются заранее.
+    static void prefetch(const int* target_column, std::span<const int> attack,
+                         std::span<const Hit> hits, std::size_t i)
+    {
+        if (i + prefetch_distance < hits.size())
+        {
+            const Hit& ahead = hits[i + prefetch_distance];
+            __builtin_prefetch(&attack[ahead.attacker]);
+            __builtin_prefetch(target_column + ahead.target, 1);
+        }
+    }
+
+    void apply_dense(std::span<int> health)
+    {
+        const std::size_t units = health.size();
+        const std::size_t full = units - units % block;
+
+        for (std::size_t begin = 0; begin < full; begin += block)
+            apply_block(health.data() + begin, m_damage.data() + begin, begin, block);
+        if (full < units)
+            apply_block(health.data() + full, m_damage.data() + full, full, units - full);
+    }
+
+    // Полные блоки идут с постоянным числом итераций — такой цикл
+    // векторизуется и при -O2 (дешёвая модель стоимости GCC).
+    void apply_block(int* __restrict hp, int* __restrict damage, std::size_t base, std::size_t count)
+    {
+        std::uint8_t died[block];
+        unsigned any = 0;
+
+        auto step = [&](std::size_t i)
+        {
+            const int before = hp[i];
+            const int after = remaining(before, damage[i]);
+            hp[i] = after;
+            damage[i] = 0;
+            died[i] = (before > 0) & (after == 0);
+            any |= died[i];
+        };
+
+        if (count == block)
+            for (std::size_t i = 0; i < block; ++i)
+                step(i);
+        else
+            for (std::size_t i = 0; i < count; ++i)
+                step(i);
+
+        if (any)
+            for (std::size_t i = 0; i < count; ++i)
+                if (died[i])
+                    m_dead.push_back(static_cast<Slot>(base + i));
+    }
+
+    std::vector<int> m_damage;
+    std::vector<Slot> m_dead;
+};
@@ -0,0 +1,365 @@
+#pragma once
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+// Все алгоритмы раскрывают пакет параметров целиком (pack expansion,
+// fold-выражения, constexpr-вычисления над массивами), а не отщепляют
+// по одному типу: глубина инстанцирования не зависит от длины списка.
+
+template <typename... Ts>
+struct Deque {};
+
+template <typename D>
+struct Size {};
+
+template <typename... Ts>
+struct Size<Deque<Ts...>>
+{
+    static constexpr std::size_t value = sizeof...(Ts);
+};
+
+template <typename D>
+constexpr std::size_t size_v = Size<D>::value;
+
+template <typename D>
+constexpr bool is_empty_v = size_v<D> == 0;
+
+// Встроенный __is_same не инстанцирует шаблонов — важно для Has/Index_Of,
+// которые сравнивают тип с каждым элементом списка.
+#if defined(__has_builtin) && __has_builtin(__is_same)
+#define DEQUE_IS_SAME(T, U) __is_same(T, U)
+#else
+#define DEQUE_IS_SAME(T, U) std::is_same_v<T, U>
+#endif
+
+//////////////////////////////////////////////////////////////////
+
+template <typename D, std::size_t I>
+struct Nth {};
+
+#if defined(__has_builtin) && __has_builtin(__type_pack_element)
+
+template <typename... Ts, std::size_t I>
+struct Nth<Deque<Ts...>, I>
+{
+    static_assert(I < sizeof...(Ts), "Index out of bounds");
+    using type = __type_pack_element<I, Ts...>;
+};
+
+#else
+
+// Без встроенного __type_pack_element: класс наследует Indexed<I, T>
+// для каждого элемента, и нужный тип выводится разрешением перегрузки.
+template <std::size_t I, typename T>
+struct Indexed
+{
+    using type = T;
+};
+
+template <typename Seq, typename... Ts>
+struct Indexer;
+
+template <std::size_t... Is, typename... Ts>
+struct Indexer<std::index_sequence<Is...>, Ts...> : Indexed<Is, Ts>... {};
+
+template <std::size_t I, typename T>
+Indexed<I, T> select_indexed(const Indexed<I, T>&);
+
+template <typename... Ts, std::size_t I>
+struct Nth<Deque<Ts...>, I>
+{
+    static_assert(I < sizeof...(Ts), "Index out of bounds");
+    using type = typename decltype(select_indexed<I>(
+        std::declval<Indexer<std::index_sequence_for<Ts...>, Ts...>>()))::type;
+};
+
+#endif
+
+template <typename D, std::size_t I>
+using nth = typename Nth<D, I>::type;
+
+//////////////////////////////////////////////////////////////////
+
+// Deque из элементов D с индексами Indices (std::array, вычисленный
+// на этапе компиляции) — общая основа для pop_back, filter, unique и сортировок.
+template <typename D, auto Indices, typename Seq = std::make_index_sequence<Indices.size()>>
+struct Pick {};
+
+template <typename D, auto Indices, std::size_t... Is>
+struct Pick<D, Indices, std::index_sequence<Is...>>
+{
+    using type = Deque<nth<D, Indices[Is]>...>;
+};
+
+template <typename D, auto Indices>
+using pick = typename Pick<D, Indices>::type;
+
+template <std::size_t N>
+constexpr std::array<std::size_t, N> iota_indices()
+{
+    std::array<std::size_t, N> result{};
+    for (std::size_t i = 0; i < N; ++i)
+        result[i] = i;
+    return result;
+}
+
+// Индексы элементов, для которых mask[i] == true, в исходном порядке.
+template <std::size_t Count, std::size_t N>
+constexpr std::array<std::size_t, Count> mask_indices(const std::array<bool, N>& mask)
+{
+    std::array<std::size_t, Count> result{};
+    std::size_t j = 0;
+    for (std::size_t i = 0; i < N; ++i)
+        if (mask[i])
+            result[j++] = i;
+    return result;
+}
+
+template <typename D, auto Mask>
+using pick_mask =
+    pick<D, mask_indices<std::count(Mask.begin(), Mask.end(), true)>(Mask)>;
+
+//////////////////////////////////////////////////////////////////
+
+template <typename D>
+struct Front {};
+
+template <typename T, typename... Ts>
+struct Front<Deque<T, Ts...>>
+{
+    using type = T;
+};
+
+template <typename D>
+using front = typename Front<D>::type;
+
+template <typename D>
+struct Back {};
+
+template <typename T, typename... Ts>
+struct Back<Deque<T, Ts...>>
+{
+    using type = nth<Deque<T, Ts...>, sizeof...(Ts)>;
+};
+
+template <typename D>
+using back = typename Back<D>::type;
+
+//////////////////////////////////////////////////////////////////
+
+template <typename T, typename D>
+struct Push_Front {};
+
+template <typename T, typename... Ts>
+struct Push_Front<T, Deque<Ts...>>
+{
+    using type = Deque<T, Ts...>;
+};
+
+template <typename T, typename D>
+using push_front = typename Push_Front<T, D>::type;
+
+template <typename T, typename D>
+struct Push_Back {};
+
+template <typename T, typename... Ts>
+struct Push_Back<T, Deque<Ts...>>
+{
+    using type = Deque<Ts..., T>;
+};
+
+template <typename T, typename D>
+using push_back = typename Push_Back<T, D>::type;
+
+//////////////////////////////////////////////////////////////////
+
+template <typename D>
+struct Pop_Front {};
+
+template <typename T, typename... Ts>
+struct Pop_Front<Deque<T, Ts...>>
+{
+    using type = Deque<Ts...>;
+};
+
+template <typename D>
+using pop_front = typename Pop_Front<D>::type;
+
+template <typename D>
+struct Pop_Back {};
+
+template <typename T, typename... Ts>
+struct Pop_Back<Deque<T, Ts...>>
+{
+    using type = pick<Deque<T, Ts...>, iota_indices<sizeof...(Ts)>()>;
+};
+
+template <typename D>
+using pop_back = typename Pop_Back<D>::type;
+
+//////////////////////////////////////////////////////////////////
+
+template <typename D>
+struct Max_Type {};
+
+template <>
+struct Max_Type<Deque<>>
+{
+    using type = std::byte;
+};
+
+// При равных размерах выбирается первый из наибольших типов.
+template <typename... Ts>
+struct Max_Type<Deque<Ts...>>
+{
+private:
+    static constexpr std::size_t index = []
+    {
+        constexpr std::size_t sizes[] = {sizeof(Ts)...};
+        return static_cast<std::size_t>(std::max_element(std::begin(sizes), std::end(sizes)) - sizes);
+    }();
+
+public:
+    using type = nth<Deque<Ts...>, index>;
+};
+
+template <typename D>
+using max_type = typename Max_Type<D>::type;
+
+//////////////////////////////////////////////////////////////////
+
+template <typename T, typename D>
+struct Has {};
+
+template <typename T, typename... Ts>
+struct Has<T, Deque<Ts...>>
+{
+    static constexpr bool value = (DEQUE_IS_SAME(T, Ts) || ...);
+};
+
+template <typename T, typename D>
+constexpr bool has_v = Has<T, D>::value;
+
+// Индекс первого вхождения T в D; size_v<D>, если T в D нет.
+template <typename T, typename D>
+struct Index_Of {};
+
+template <typename T, typename... Ts>
+struct Index_Of<T, Deque<Ts...>>
+{
+    static constexpr std::size_t value = []
+    {
+        constexpr bool matches[] = {DEQUE_IS_SAME(T, Ts)..., false};
+        return static_cast<std::size_t>(std::find(std::begin(matches), std::end(matches) - 1, true) - matches);
+    }();
+};
+
+template <typename T, typename D>
+constexpr std::size_t index_of_v = Index_Of<T, D>::value;
+
+//////////////////////////////////////////////////////////////////
+
+template <template <typename> class F, typename D>
+struct Transform {};
+
+template <template <typename> class F, typename... Ts>
+struct Transform<F, Deque<Ts...>>
+{
+    using type = Deque<F<Ts>...>;
+};
+
+template <template <typename> class F, typename D>
+using transform = typename Transform<F, D>::type;
+
+template <template <typename> class Pred, typename D>
+struct Filter {};
+
+template <template <typename> class Pred, typename... Ts>
+struct Filter<Pred, Deque<Ts...>>
+{
+    using type = pick_mask<Deque<Ts...>, std::array<bool, sizeof...(Ts)>{Pred<Ts>::value...}>;
+};
+
+template <template <typename> class Pred, typename D>
+using filter = typename Filter<Pred, D>::type;
+
+// Оставляет первое вхождение каждого типа.
+template <typename D>
+struct Unique {};
+
+template <typename... Ts>
+struct Unique<Deque<Ts...>>
+{
+private:
+    static constexpr std::array<bool, sizeof...(Ts)> mask = []
+    {
+        constexpr std::size_t first[] = {index_of_v<Ts, Deque<Ts...>>..., 0};
+        std::array<bool, sizeof...(Ts)> result{};
+        for (std::size_t i = 0; i < result.size(); ++i)
+            result[i] = first[i] == i;
+        return result;
+    }();
+
+public:
+    using type = pick_mask<Deque<Ts...>, mask>;
+};
+
+template <typename D>
+using unique = typename Unique<D>::type;
+
+//////////////////////////////////////////////////////////////////
+
+// Индексы 0..N-1, устойчиво упорядоченные по keys (по возрастанию
+// или по убыванию ключа).
+template <std::size_t N>
+constexpr std::array<std::size_t, N> sorted_indices(const std::array<std::size_t, N>& keys,
+                                                    bool descending = false)
+{
+    // Слиянием снизу вверх, O(N log N): на списках в тысячи типов
+    // квадратичная сортировка упирается в лимит constexpr-операций.
+    // Сравнение — обычное выражение, а не лямбда для std::sort: та
+    // роняет GCC 12, когда Deque.hpp собран в модуль (Variant.ixx).
+    auto result = iota_indices<N>();
+    std::array<std::size_t, N> buffer{};
+    for (std::size_t width = 1; width < N; width *= 2)
+    {
+        for (std::size_t low = 0; low < N; low += 2 * width)
+        {
+            const std::size_t middle = std::min(low + width, N);
+            const std::size_t high = std::min(low + 2 * width, N);
+            std::size_t i = low, j = middle, out = low;
+            while (i < middle && j < high)
+            {
+                // При равных ключах первым идёт левый — отсюда устойчивость.
+                const bool right_first = descending ? keys[result[i]] < keys[result[j]]
+                                                    : keys[result[j]] < keys[result[i]];
+                buffer[out++] = right_first ? result[j++] : result[i++];
+            }
+            while (i < middle)
+                buffer[out++] = result[i++];
+            while (j < high)
+                buffer[out++] = result[j++];
+        }
+        result = buffer;
+    }
+    return result;
+}
+
+template <typename D>
+struct Sort_By_Size {};
+
+template <typename... Ts>
+struct Sort_By_Size<Deque<Ts...>>
+{
+    using type = pick<
+        Deque<Ts...>,
+        sorted_indices<sizeof...(Ts)>({sizeof(Ts)...})>;
+};
+
+template <typename D>
+using sort_by_size = typename Sort_By_Size<D>::type;
+
+#undef DEQUE_IS_SAME
@@ -0,0 +1,221 @@
+#pragma once
+#include <atomic>
+#include <concepts>
+#include <cstddef>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <utility>
+
+// Однократно вычисляемое имя. Первый вызов get() строит строку под
+// мьютексом, последующие — одна атомарная загрузка. Сбрасывается
+// только изменяющими методами, то есть при монопольном доступе.
+class NameCache
+{
+public:
+    NameCache() = default;
+    NameCache(const NameCache&) {}
+    NameCache& operator=(const NameCache&) { reset(); return *this; }
+
+    template <typename F>
+    std::string_view get(F&& compute) const
+    {
+        if (!m_ready.load(std::memory_order_acquire))
+        {
+            std::lock_guard lock(m_mutex);
+            if (!m_ready.load(std::memory_order_relaxed))
+            {
+                m_value = std::forward<F>(compute)();
+                m_ready.store(true, std::memory_order_release);
+            }
+        }
+        return m_value;
+    }
+
+    void reset() { m_ready.store(false, std::memory_order_relaxed); }
+
+private:
+    mutable std::atomic<bool> m_ready = false;
+    mutable std::mutex m_mutex;
+    mutable std::string m_value;
+};
+
+////////////////////////////////////////////////////////////////////////////////////
+
+class Entity
+{
+public:
+    virtual ~Entity() = default;
+    virtual std::string_view name() const = 0;
+    virtual int value() const = 0;
+
+protected:
+    // Имя внутренней сущности изменилось: слои с кэшем сбрасывают его.
+    virtual void name_changed() {}
+};
+
+class BaseEntity : public virtual Entity
+{
+public:
+    template <typename S>
+        requires std::constructible_from<std::string, S>
+    BaseEntity(S&& n, int v)
+        : m_name(std::forward<S>(n)), m_value(v) {}
+
+    std::string_view name() const override { return m_name; }
+    int value() const override { return m_value; }
+
+    void rename(std::string n)
+    {
+        m_name = std::move(n);
+        name_changed();
+    }
+
+private:
+    std::string m_name;
+    int m_value = 0;
+};
+
+template <typename T>
+class Decorator : public virtual Entity, public T
+{
+public:
+    template <typename... Args>
+    Decorator(Args&&... args)
+        : T(std::forward<Args>(args)...) {}
+
+    // Строится один раз из уже закэшированного имени внутреннего слоя.
+    std::string_view name() const override
+    {
+        return m_name_cache.get([this]
+        {
+            const std::string_view inner = T::name();
+
+            std::string result;
+            result.reserve(inner.size() + 11);
+            result.append("Decorated(").append(inner).append(")");
+            return result;
+        });
+    }
+
+    int value() const override
+    {
+        return T::value() + 10;
+    }
+
+protected:
+    void name_changed() override
+    {
+        m_name_cache.reset();
+        T::name_changed();
+    }
+
+private:
+    NameCache m_name_cache;
+};
+
+////////////////////////////////////////////////////////////////////////////////////
+
+// Статическая композиция декораторов: слои — миксины без виртуальных
+// функций, value() всех слоёв встраивается в одно выражение, а префикс
+// и суффикс имени склеиваются на этапе компиляции, так что name()
+// делает одно выделение памяти независимо от глубины.
+
+template <std::size_t N>
+struct FixedString
+{
+    char data[N + 1] = {};
+
+    constexpr FixedString() = default;
+
+    constexpr FixedString(const char (&str)[N + 1])
+    {
+        for (std::size_t i = 0; i < N; ++i)
+            data[i] = str[i];
+    }
+
+    constexpr std::string_view view() const { return {data, N}; }
+};
+
+template <std::size_t N>
+FixedString(const char (&)[N]) -> FixedString<N - 1>;
+
+template <std::size_t A, std::size_t B>
+constexpr FixedString<A + B> operator+(const FixedString<A>& lhs, const FixedString<B>& rhs)
+{
+    FixedString<A + B> result;
+    for (std::size_t i = 0; i < A; ++i)
+        result.data[i] = lhs.data[i];
+    for (std::size_t i = 0; i < B; ++i)
+        result.data[A + i] = rhs.data[i];
+    return result;
+}
+
+class StaticEntity
+{
+public:
+    StaticEntity(std::string n, int v)
+        : m_name(std::move(n)), m_value(v) {}
+
+    static constexpr FixedString<0> name_prefix{};
+    static constexpr FixedString<0> name_suffix{};
+
+    std::string_view base_name() const { return m_name; }
+
+    std::string name() const { return m_name; }
+    int value() const { return m_value; }
+
+private:
+    std::string m_name;
+    int m_value = 0;
+};
+
+template <typename T>
+class StaticDecorator : public T
+{
+public:
+    using T::T;
+
+    static constexpr auto name_prefix = FixedString("Decorated(") + T::name_prefix;
+    static constexpr auto name_suffix = T::name_suffix + FixedString(")");
+
+    std::string name() const
+    {
+        constexpr std::string_view prefix = name_prefix.view();
+        constexpr std::string_view suffix = name_suffix.view();
+        const std::string_view base = this->base_name();
+
+        std::string result;
+        result.reserve(prefix.size() + base.size() + suffix.size());
+        result.append(prefix).append(base).append(suffix);
+        return result;
+    }
+
+    int value() const
+    {
+        return T::value() + 10;
+    }
+};
+
+// Подключение статической цепочки там, где нужен Entity*.
+template <typename T>
+class EntityAdapter : public virtual Entity
+{
+public:
+    template <typename... Args>
+    EntityAdapter(Args&&... args)
+        : m_entity(std::forward<Args>(args)...) {}
+
+    std::string_view name() const override
+    {
+        return m_name_cache.get([this] { return std::string(m_entity.name()); });
+    }
+
+    int value() const override { return m_entity.value(); }
+
+    const T& get() const { return m_entity; }
+
+private:
+    T m_entity;
+    NameCache m_name_cache;
+};
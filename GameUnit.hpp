@@ -0,0 +1,142 @@
+#pragma once
+#include "Instrument.hpp"
+
+#include <iostream>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+class Character
+{
+public:
+    std::string name;
+    int health = 100;
+    int attackPower = 10;
+
+    void info() const
+    {
+        std::cout << "Character: " << name 
+                  << " [HP=" << health 
+                  << ", ATK=" << attackPower << "]\n";
+    }
+};
+
+class CharacterBuilder
+{
+public:
+    CharacterBuilder& setName(std::string n) & { m_character.name = std::move(n); return *this; }
+    CharacterBuilder& setHealth(int h) & { m_character.health = h; return *this; }
+    CharacterBuilder& setAttack(int a) & { m_character.attackPower = a; return *this; }
+
+    CharacterBuilder&& setName(std::string n) && { return std::move(setName(std::move(n))); }
+    CharacterBuilder&& setHealth(int h) && { return std::move(setHealth(h)); }
+    CharacterBuilder&& setAttack(int a) && { return std::move(setAttack(a)); }
+
+    Character get() { return m_character; }
+    Character build() && { return std::move(m_character); }
+
+private:
+    Character m_character;
+};
+
+// Результат атаки одного юнита — вместо строки в std::cout.
+struct AttackEvent
+{
+    std::string_view attacker;
+    int damage = 0;
+};
+
+class UnitGroup;
+
+class GameUnit
+{
+public:
+    virtual ~GameUnit() = default;
+    virtual void info(int indent = 0) const = 0;
+    virtual void attack() = 0;
+
+    // Число одиночных юнитов в поддереве.
+    virtual std::size_t unitCount() const = 0;
+
+    // Записывает события атаки всех юнитов поддерева подряд, начиная
+    // с out, в том же порядке, что и attack(); возвращает конец записи.
+    virtual AttackEvent* collectAttacks(AttackEvent* out) const = 0;
+
+    virtual const UnitGroup* asGroup() const { return nullptr; }
+};
+
+using GameUnitPtr = std::shared_ptr<GameUnit>;
+
+class SingleUnit : public GameUnit
+{
+public:
+    SingleUnit(Character c) : m_character(std::move(c)) {}
+
+    void info(int indent = 0) const override
+    {
+        std::cout << std::string(indent, ' ');
+        m_character.info();
+    }
+
+    void attack() override
+    {
+        INSTRUMENT_COUNT("unit.attack");
+        std::cout << m_character.name << " attacks for " << m_character.attackPower << " damage!\n";
+    }
+
+    std::size_t unitCount() const override { return 1; }
+
+    AttackEvent* collectAttacks(AttackEvent* out) const override
+    {
+        INSTRUMENT_COUNT("unit.collect");
+        *out = {m_character.name, m_character.attackPower};
+        return out + 1;
+    }
+
+    const Character& character() const { return m_character; }
+
+private:
+    Character m_character;
+};
+
+class UnitGroup : public GameUnit
+{
+public:
+    void addUnit(GameUnitPtr unit) { m_units.push_back(unit); }
+
+    void info(int indent = 0) const override
+    {
+        std::cout << std::string(indent, ' ') << "UnitGroup:\n";
+        for (auto& u : m_units) u->info(indent + 2);
+    }
+
+    void attack() override
+    {
+        INSTRUMENT_SCOPE("UnitGroup::attack");
+        for (auto& u : m_units) u->attack();
+    }
+
+    std::size_t unitCount() const override
+    {
+        std::size_t count = 0;
+        for (auto& u : m_units) count += u->unitCount();
+        return count;
+    }
+
+    AttackEvent* collectAttacks(AttackEvent* out) const override
+    {
+        INSTRUMENT_SCOPE("UnitGroup::collectAttacks");
+        for (auto& u : m_units) out = u->collectAttacks(out);
+        return out;
+    }
+
+    const UnitGroup* asGroup() const override { return this; }
+
+    const std::vector<GameUnitPtr>& units() const { return m_units; }
+
+private:
+    std::vector<GameUnitPtr> m_units;
+};
@@ -0,0 +1,483 @@
+#pragma once
+
+// Инструментирование горячих путей: счётчики, таймеры областей по RDTSC
+// и гистограммы. У каждого потока свои значения (thread_local), запись —
+// без блокировок и атомарных read-modify-write.
+//
+//   INSTRUMENT_COUNT("sort.compare");          — счётчик + 1
+//   INSTRUMENT_ADD("vector.moved", n);         — счётчик + n
+//   INSTRUMENT_HISTOGRAM("sort.partition", n); — значение в гистограмму
+//   INSTRUMENT_SCOPE("UnitGroup::attack");     — такты до конца блока в
+//       гистограмму таймера, а после start_trace() — ещё и событие трассы.
+//
+// Включается макросом INSTRUMENT_ENABLED=1 (в CMake — C_MIPT_INSTRUMENT=ON).
+// Без него макросы пусты, аргументы не вычисляются, а из instrument
+// остаются только пустые функции вывода.
+//
+// Имя метрики — строковый литерал. Место вызова регистрирует его один
+// раз; одинаковые имена из разных мест — одна метрика. Гистограммы
+// логарифмические: корзина k — значения из [2^(k-1), 2^k).
+//
+// Итоги по всем потокам, живым и завершившимся, — snapshot(). Вывод:
+//   write_report       — таблица;
+//   write_perf_csv     — строки как у perf stat -x, (value,unit,event);
+//   write_chrome_trace — Trace Event Format для chrome://tracing и Perfetto.
+
+#include <iosfwd>
+
+#ifndef INSTRUMENT_ENABLED
+#define INSTRUMENT_ENABLED 0
+#endif
+
+#if INSTRUMENT_ENABLED
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string_view>
+#include <vector>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+namespace instrument
+{
+
+inline constexpr bool enabled = true;
+
+inline constexpr std::size_t max_metrics = 128;
+inline constexpr std::size_t buckets = 48;
+
+// Событий трассы на поток; лишние отбрасываются и считаются в
+// instrument.dropped.
+inline constexpr std::size_t trace_capacity = std::size_t(1) << 16;
+
+enum class Kind : std::uint8_t { counter, histogram, timer };
+
+inline std::uint64_t ticks()
+{
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    return std::chrono::steady_clock::now().time_since_epoch().count();
+#endif
+}
+
+struct TraceEvent
+{
+    std::uint64_t start;
+    std::uint64_t duration;
+    std::uint32_t metric;
+    std::uint32_t thread;
+};
+
+struct MetricSnapshot
+{
+    std::string_view name;
+    Kind kind;
+    std::uint64_t count;    // значений в гистограмме; у счётчика — 0
+    std::uint64_t sum;      // сумма; у таймера — в тактах
+    std::array<std::uint64_t, buckets> histogram;
+};
+
+namespace detail
+{
+
+// Значения одного потока. Пишет только владелец (load + store, без
+// lock-префикса), читают snapshot() и экспорт — поэтому atomic.
+struct ThreadState
+{
+    std::array<std::atomic<std::uint64_t>, max_metrics> sum{};
+    std::array<std::array<std::atomic<std::uint64_t>, buckets>, max_metrics> histogram{};
+
+    // Трасса: буфер выделяется при первом событии, size публикуется
+    // с release — читатель видит только записанные события.
+    std::unique_ptr<TraceEvent[]> trace;
+    std::atomic<std::size_t> trace_size{0};
+
+    std::uint32_t thread = 0;
+
+    ThreadState();
+    ~ThreadState();
+};
+
+inline void bump(std::atomic<std::uint64_t>& value, std::uint64_t n)
+{
+    value.store(value.load(std::memory_order_relaxed) + n, std::memory_order_relaxed);
+}
+
+struct Registry
+{
+    std::mutex mutex;
+    std::array<const char*, max_metrics> names{};
+    std::array<Kind, max_metrics> kinds{};
+    std::atomic<std::uint32_t> size{0};
+
+    std::vector<ThreadState*> threads;
+    std::uint32_t next_thread = 0;
+
+    // Итоги завершившихся потоков.
+    std::array<std::uint64_t, max_metrics> retired_sum{};
+    std::array<std::array<std::uint64_t, buckets>, max_metrics> retired_histogram{};
+    std::vector<TraceEvent> retired_trace;
+
+    std::atomic<bool> tracing{false};
+
+    // Точка отсчёта для перевода тактов во время.
+    const std::uint64_t origin_ticks = ticks();
+    const std::chrono::steady_clock::time_point origin_time = std::chrono::steady_clock::now();
+};
+
+inline Registry& registry()
+{
+    static Registry instance;
+    return instance;
+}
+
+inline ThreadState::ThreadState()
+{
+    Registry& r = registry();
+    std::lock_guard lock(r.mutex);
+    thread = r.next_thread++;
+    r.threads.push_back(this);
+}
+
+inline ThreadState::~ThreadState()
+{
+    Registry& r = registry();
+    std::lock_guard lock(r.mutex);
+    for (std::size_t i = 0; i < max_metrics; ++i)
+    {
+        r.retired_sum[i] += sum[i].load(std::memory_order_relaxed);
+        for (std::size_t k = 0; k < buckets; ++k)
+            r.retired_histogram[i][k] += histogram[i][k].load(std::memory_order_relaxed);
+    }
+    r.retired_trace.insert(r.retired_trace.end(), trace.get(), trace.get() + trace_size.load());
+    r.threads.erase(std::find(r.threads.begin(), r.threads.end(), this));
+}
+
+// Состояние потока — в куче: в TLS оно заняло бы ~50 КБ на поток.
+inline ThreadState& thread_state()
+{
+    thread_local const std::unique_ptr<ThreadState> state = std::make_unique<ThreadState>();
+    return *state;
+}
+
+inline std::uint32_t register_metric(const char* name, Kind kind)
+{
+    Registry& r = registry();
+    std::lock_guard lock(r.mutex);
+    const std::uint32_t size = r.size.load(std::memory_order_relaxed);
+    for (std::uint32_t i = 0; i < size; ++i)
+        if (std::strcmp(r.names[i], name) == 0)
+            return i;
+
+    // Реестр полон: последняя ячейка — instrument.overflow, в неё идут
+    // все лишние имена.
+    if (size >= max_metrics - 1)
+    {
+        if (size == max_metrics - 1)
+        {
+            r.names[size] = "instrument.overflow";
+            r.kinds[size] = Kind::counter;
+            r.size.store(max_metrics, std::memory_order_release);
+        }
+        return max_metrics - 1;
+    }
+    r.names[size] = name;
+    r.kinds[size] = kind;
+    r.size.store(size + 1, std::memory_order_release);
+    return size;
+}
+
+inline std::size_t bucket(std::uint64_t value)
+{
+    return std::min<std::size_t>(std::bit_width(value), buckets - 1);
+}
+
+inline std::uint32_t dropped_metric()
+{
+    static const std::uint32_t id = register_metric("instrument.dropped", Kind::counter);
+    return id;
+}
+
+inline void trace(std::uint32_t metric, std::uint64_t start, std::uint64_t duration)
+{
+    ThreadState& state = thread_state();
+    const std::size_t size = state.trace_size.load(std::memory_order_relaxed);
+    if (size == trace_capacity)
+    {
+        bump(state.sum[dropped_metric()], 1);
+        return;
+    }
+    if (!state.trace)
+    {
+        // Выделение под мьютексом: экспорт читает указатель под ним же.
+        std::lock_guard lock(registry().mutex);
+        state.trace = std::make_unique<TraceEvent[]>(trace_capacity);
+    }
+    state.trace[size] = {start, duration, metric, state.thread};
+    state.trace_size.store(size + 1, std::memory_order_release);
+}
+
+} // namespace detail
+
+//////////////////////////////////////////////////////////////////
+
+inline void add(std::uint32_t metric, std::uint64_t n)
+{
+    detail::bump(detail::thread_state().sum[metric], n);
+}
+
+inline void record(std::uint32_t metric, std::uint64_t value)
+{
+    detail::ThreadState& state = detail::thread_state();
+    detail::bump(state.sum[metric], value);
+    detail::bump(state.histogram[metric][detail::bucket(value)], 1);
+}
+
+class Scope
+{
+public:
+    explicit Scope(std::uint32_t metric) : m_metric(metric), m_start(ticks()) {}
+
+    Scope(const Scope&) = delete;
+    Scope& operator=(const Scope&) = delete;
+
+    ~Scope()
+    {
+        const std::uint64_t duration = ticks() - m_start;
+        record(m_metric, duration);
+        if (detail::registry().tracing.load(std::memory_order_relaxed))
+            detail::trace(m_metric, m_start, duration);
+    }
+
+private:
+    std::uint32_t m_metric;
+    std::uint64_t m_start;
+};
+
+// -------------------------------------------------
+
+// Запись трассы идёт между start_trace() и stop_trace(); start_trace()
+// стирает записанное раньше.
+inline void start_trace()
+{
+    detail::Registry& r = detail::registry();
+    std::lock_guard lock(r.mutex);
+    r.retired_trace.clear();
+    for (detail::ThreadState* state : r.threads)
+        state->trace_size.store(0, std::memory_order_relaxed);
+    r.tracing.store(true, std::memory_order_relaxed);
+}
+
+inline void stop_trace() { detail::registry().tracing.store(false, std::memory_order_relaxed); }
+
+// Обнуление между замерами. Приращения, идущие в других потоках в этот
+// момент, могут пропасть.
+inline void reset()
+{
+    detail::Registry& r = detail::registry();
+    std::lock_guard lock(r.mutex);
+    r.retired_sum = {};
+    r.retired_histogram = {};
+    for (detail::ThreadState* state : r.threads)
+    {
+        for (auto& value : state->sum)
+            value.store(0, std::memory_order_relaxed);
+        for (auto& row : state->histogram)
+            for (auto& value : row)
+                value.store(0, std::memory_order_relaxed);
+    }
+}
+
+inline std::vector<MetricSnapshot> snapshot()
+{
+    detail::Registry& r = detail::registry();
+    std::lock_guard lock(r.mutex);
+
+    std::vector<MetricSnapshot> result;
+    const std::uint32_t size = r.size.load(std::memory_order_relaxed);
+    for (std::uint32_t i = 0; i < size; ++i)
+    {
+        MetricSnapshot m{r.names[i], r.kinds[i], 0, r.retired_sum[i], r.retired_histogram[i]};
+        for (detail::ThreadState* state : r.threads)
+        {
+            m.sum += state->sum[i].load(std::memory_order_relaxed);
+            for (std::size_t k = 0; k < buckets; ++k)
+                m.histogram[k] += state->histogram[i][k].load(std::memory_order_relaxed);
+        }
+        for (std::uint64_t n : m.histogram)
+            m.count += n;
+        result.push_back(m);
+    }
+    return result;
+}
+
+// Наносекунд в такте — по steady_clock с момента первого обращения.
+inline double ns_per_tick()
+{
+    const detail::Registry& r = detail::registry();
+    const std::uint64_t elapsed_ticks = ticks() - r.origin_ticks;
+    const double elapsed_ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - r.origin_time).count();
+    return elapsed_ticks ? elapsed_ns / double(elapsed_ticks) : 1.0;
+}
+
+// Верхняя граница корзины, в которую попадает доля q событий.
+inline std::uint64_t quantile(const MetricSnapshot& m, double q)
+{
+    std::uint64_t seen = 0;
+    for (std::size_t k = 0; k < buckets; ++k)
+    {
+        seen += m.histogram[k];
+        if (seen > 0 && double(seen) >= q * double(m.count))
+            return k == 0 ? 0 : (std::uint64_t(1) << k) - 1;
+    }
+    return 0;
+}
+
+//////////////////////////////////////////////////////////////////
+
+inline const char* kind_name(Kind kind)
+{
+    switch (kind)
+    {
+    case Kind::counter:   return "counter";
+    case Kind::histogram: return "histogram";
+    case Kind::timer:     return "timer";
+    }
+    return "";
+}
+
+inline void write_report(std::ostream& os)
+{
+    const double ns = ns_per_tick();
+    char line[160];
+    std::snprintf(line, sizeof(line), "%-34s %-9s %12s %14s %10s %10s\n", "metric", "kind", "count", "sum", "p50", "p99");
+    os << line;
+    for (const MetricSnapshot& m : snapshot())
+    {
+        const int length = int(m.name.size());
+        if (m.kind == Kind::counter)
+        {
+            std::snprintf(line, sizeof(line), "%-34.*s %-9s %12s %14llu\n", length, m.name.data(), "counter", "",
+                          (unsigned long long)m.sum);
+            os << line;
+            continue;
+        }
+        // У таймеров сумма и квантили — в наносекундах; квантиль — верхняя
+        // граница корзины, с точностью до двух раз.
+        const double scale = m.kind == Kind::timer ? ns : 1.0;
+        std::snprintf(line, sizeof(line), "%-34.*s %-9s %12llu %14.0f %10.0f %10.0f\n", length, m.name.data(),
+                      kind_name(m.kind), (unsigned long long)m.count, double(m.sum) * scale,
+                      double(quantile(m, 0.5)) * scale, double(quantile(m, 0.99)) * scale);
+        os << line;
+    }
+}
+
+// value,unit,event — как perf stat -x, ; у гистограмм и таймеров ещё
+// event.count, у таймеров сумма в нс.
+inline void write_perf_csv(std::ostream& os)
+{
+    const double ns = ns_per_tick();
+    for (const MetricSnapshot& m : snapshot())
+    {
+        if (m.kind == Kind::timer)
+            os << std::uint64_t(double(m.sum) * ns) << ",ns," << m.name << '\n';
+        else
+            os << m.sum << ",," << m.name << '\n';
+        if (m.kind != Kind::counter)
+            os << m.count << ",," << m.name << ".count\n";
+    }
+}
+
+// Trace Event Format: события "X" по потокам (tid — номер потока в
+// порядке первого обращения) и итоговые значения счётчиков — "C".
+inline void write_chrome_trace(std::ostream& os)
+{
+    detail::Registry& r = detail::registry();
+    std::vector<TraceEvent> events;
+    {
+        std::lock_guard lock(r.mutex);
+        events = r.retired_trace;
+        for (detail::ThreadState* state : r.threads)
+            if (state->trace)
+                events.insert(events.end(), state->trace.get(),
+                              state->trace.get() + state->trace_size.load(std::memory_order_acquire));
+    }
+    std::sort(events.begin(), events.end(), [](const TraceEvent& a, const TraceEvent& b) { return a.start < b.start; });
+
+    const double us = ns_per_tick() / 1000.0;
+    const std::uint64_t origin = r.origin_ticks;
+    std::uint64_t last = origin;
+
+    char number[64];
+    os << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+    bool first = true;
+    for (const TraceEvent& e : events)
+    {
+        std::snprintf(number, sizeof(number), "\"ts\":%.3f,\"dur\":%.3f", double(e.start - origin) * us, double(e.duration) * us);
+        os << (first ? "\n" : ",\n") << "{\"name\":\"" << r.names[e.metric] << "\",\"ph\":\"X\",\"pid\":1,\"tid\":" << e.thread
+           << ',' << number << '}';
+        first = false;
+        last = std::max(last, e.start + e.duration);
+    }
+    for (const MetricSnapshot& m : snapshot())
+    {
+        if (m.kind != Kind::counter)
+            continue;
+        std::snprintf(number, sizeof(number), "\"ts\":%.3f", double(last - origin) * us);
+        os << (first ? "\n" : ",\n") << "{\"name\":\"" << m.name << "\",\"ph\":\"C\",\"pid\":1,\"tid\":0," << number
+           << ",\"args\":{\"value\":" << m.sum << "}}";
+        first = false;
+    }
+    os << "\n]}\n";
+}
+
+} // namespace instrument
+
+#define INSTRUMENT_CONCAT_(a, b) a##b
+#define INSTRUMENT_CONCAT(a, b) INSTRUMENT_CONCAT_(a, b)
+
+// Номер метрики места вызова; регистрируется при первом проходе.
+#define INSTRUMENT_METRIC(name, kind) \
+    ([]() -> std::uint32_t { static const std::uint32_t id = ::instrument::detail::register_metric(name, kind); return id; }())
+
+#define INSTRUMENT_ADD(name, n) ::instrument::add(INSTRUMENT_METRIC(name, ::instrument::Kind::counter), (n))
+#define INSTRUMENT_COUNT(name) INSTRUMENT_ADD(name, 1)
+#define INSTRUMENT_HISTOGRAM(name, value) \
+    ::instrument::record(INSTRUMENT_METRIC(name, ::instrument::Kind::histogram), (value))
+#define INSTRUMENT_SCOPE(name) \
+    ::instrument::Scope INSTRUMENT_CONCAT(instrument_scope_, __LINE__)(INSTRUMENT_METRIC(name, ::instrument::Kind::timer))
+
+#else
+
+namespace instrument
+{
+
+inline constexpr bool enabled = false;
+
+inline void start_trace() {}
+inline void stop_trace() {}
+inline void reset() {}
+inline void write_report(std::ostream&) {}
+inline void write_perf_csv(std::ostream&) {}
+inline void write_chrome_trace(std::ostream&) {}
+
+} // namespace instrument
+
+#define INSTRUMENT_ADD(name, n) ((void)0)
+#define INSTRUMENT_COUNT(name) ((void)0)
+#define INSTRUMENT_HISTOGRAM(name, value) ((void)0)
+#define INSTRUMENT_SCOPE(name) ((void)0)
+
+#endif
@@ -0,0 +1,158 @@
+#pragma once
+#include "Deque.hpp"
+
+#include <array>
+#include <cstddef>
+#include <tuple>
+#include <utility>
+
+// Раскладка набора полей без лишнего выравнивания: поля хранятся
+// в порядке убывания alignof (устойчиво — при равном выравнивании
+// сохраняется исходный порядок), а логический индекс поля отображается
+// в номер физического слота на этапе компиляции.
+
+template <std::size_t N>
+constexpr std::array<std::size_t, N> invert_indices(const std::array<std::size_t, N>& order)
+{
+    std::array<std::size_t, N> result{};
+    for (std::size_t i = 0; i < N; ++i)
+        result[order[i]] = i;
+    return result;
+}
+
+// Размер структуры с полями в исходном порядке — для сравнения.
+template <std::size_t N>
+constexpr std::size_t naive_struct_size(const std::array<std::size_t, N>& sizes,
+                                        const std::array<std::size_t, N>& aligns)
+{
+    std::size_t offset = 0;
+    std::size_t max_align = 1;
+    for (std::size_t i = 0; i < N; ++i)
+    {
+        offset = (offset + aligns[i] - 1) / aligns[i] * aligns[i] + sizes[i];
+        max_align = aligns[i] > max_align ? aligns[i] : max_align;
+    }
+    offset = (offset + max_align - 1) / max_align * max_align;
+    return offset ? offset : 1;
+}
+
+//////////////////////////////////////////////////////////////////
+
+// Физический слот P с полем типа T. Пустые типы места не занимают.
+template <std::size_t P, typename T>
+struct Slot
+{
+    Slot() = default;
+
+    template <typename U>
+    Slot(U&& u) : value(std::forward<U>(u)) {}
+
+    [[no_unique_address]] T value;
+};
+
+// Слоты — непустые базы, размещаются подряд в порядке объявления,
+// то есть в физическом порядке.
+template <typename Physical, auto Order, typename Seq = std::make_index_sequence<size_v<Physical>>>
+class Packed_Storage {};
+
+template <typename... Us, auto Order, std::size_t... Ps>
+class Packed_Storage<Deque<Us...>, Order, std::index_sequence<Ps...>> : private Slot<Ps, Us>...
+{
+public:
+    Packed_Storage() = default;
+
+    // Аргументы передаются в логическом порядке.
+    template <typename... Args>
+        requires (sizeof...(Args) == sizeof...(Us) && sizeof...(Us) > 0)
+    explicit Packed_Storage(Args&&... args)
+        : Slot<Ps, Us>(std::get<Order[Ps]>(std::forward_as_tuple(std::forward<Args>(args)...)))...
+    {}
+
+    template <std::size_t P>
+    auto& slot() { return static_cast<Slot<P, nth<Deque<Us...>, P>>&>(*this).value; }
+
+    template <std::size_t P>
+    const auto& slot() const { return static_cast<const Slot<P, nth<Deque<Us...>, P>>&>(*this).value; }
+};
+
+//////////////////////////////////////////////////////////////////
+
+template <typename D>
+struct Layout {};
+
+template <typename... Ts>
+struct Layout<Deque<Ts...>>
+{
+    static constexpr std::size_t count = sizeof...(Ts);
+
+    // order[P] — логический индекс поля в физическом слоте P.
+    static constexpr std::array<std::size_t, count> order =
+        sorted_indices<count>({alignof(Ts)...}, true);
+
+    // slot[I] — физический слот логического поля I.
+    static constexpr std::array<std::size_t, count> slot = invert_indices(order);
+
+    using physical = pick<Deque<Ts...>, order>;
+
+    using storage = Packed_Storage<physical, order>;
+
+    static constexpr std::size_t naive_size =
+        naive_struct_size<count>({sizeof(Ts)...}, {alignof(Ts)...});
+};
+
+// Хранилище полей D с оптимальной раскладкой и доступом по логическому индексу.
+template <typename D>
+class Packed : private Layout<D>::storage
+{
+    using layout  = Layout<D>;
+    using storage = typename layout::storage;
+
+public:
+    using storage::storage;
+
+    Packed() = default;
+
+    template <std::size_t I>
+    nth<D, I>& get() { return storage::template slot<layout::slot[I]>(); }
+
+    template <std::size_t I>
+    const nth<D, I>& get() const { return storage::template slot<layout::slot[I]>(); }
+};
+
+//////////////////////////////////////////////////////////////////
+
+// Запись из именованных полей: каждое поле — тег с вложенным типом
+// (struct Id { using type = int; };), доступ — get<Id>().
+template <typename... Fields>
+class Record
+{
+    using fields = Deque<Fields...>;
+    using types  = Deque<typename Fields::type...>;
+
+public:
+    Record() = default;
+
+    explicit Record(typename Fields::type... values)
+        requires (sizeof...(Fields) > 0)
+        : m_storage(std::move(values)...)
+    {}
+
+    template <typename F>
+    typename F::type& get()
+    {
+        static_assert(has_v<F, fields>, "No such field in record");
+        return m_storage.template get<index_of_v<F, fields>>();
+    }
+
+    template <typename F>
+    const typename F::type& get() const
+    {
+        static_assert(has_v<F, fields>, "No such field in record");
+        return m_storage.template get<index_of_v<F, fields>>();
+    }
+
+    static constexpr std::size_t naive_size = Layout<types>::naive_size;
+
+private:
+    Packed<types> m_storage;
+};
@@ -0,0 +1,125 @@
+#pragma once
+#include "GameUnit.hpp"
+#include "ThreadPool.hpp"
+
+#include <cassert>
+#include <cstddef>
+#include <span>
+#include <vector>
+
+// План параллельной атаки дерева GameUnit. Дерево один раз разбивается
+// на задания примерно по grain юнитов: большие подгруппы делятся дальше,
+// подряд идущие маленькие дети группы объединяются в одно задание.
+// Каждое задание знает своё смещение в порядке обхода, поэтому пишет
+// события в свой непересекающийся участок общего буфера, и результат
+// совпадает с последовательным collectAttacks() — независимо от числа
+// потоков и порядка выполнения заданий.
+//
+// План хранит указатели на узлы дерева: после изменения дерева его
+// нужно построить заново.
+
+class AttackPlan
+{
+public:
+    explicit AttackPlan(const GameUnit& root, std::size_t grain = 4096)
+        : m_grain(grain ? grain : 1)
+    {
+        if (const UnitGroup* group = root.asGroup())
+            m_size = split(*group, 0);
+        else
+        {
+            m_size = root.unitCount();
+            m_items.push_back({&root, {}, 0});
+        }
+    }
+
+    // Число событий — нужный размер буфера.
+    std::size_t size() const { return m_size; }
+
+    std::size_t items() const { return m_items.size(); }
+
+    void run(ThreadPool& pool, std::span<AttackEvent> out) const
+    {
+        assert(out.size() >= m_size);
+
+        pool.run(m_items.size(), [&](std::size_t i)
+        {
+            const WorkItem& item = m_items[i];
+            AttackEvent* at = out.data() + item.offset;
+            if (item.unit)
+                item.unit->collectAttacks(at);
+            else
+                for (const auto& unit : item.units)
+                    at = unit->collectAttacks(at);
+        });
+    }
+
+private:
+    // Либо один узел целиком, либо отрезок детей одной группы.
+    struct WorkItem
+    {
+        const GameUnit* unit = nullptr;
+        std::span<const GameUnitPtr> units;
+        std::size_t offset = 0;
+    };
+
+    // Добавляет задания для детей группы, начиная со смещения offset;
+    // возвращает число юнитов в группе.
+    std::size_t split(const UnitGroup& group, std::size_t offset)
+    {
+        const std::span<const GameUnitPtr> units = group.units();
+        const std::size_t start = offset;
+
+        std::size_t run_begin = 0, run_offset = offset, run_count = 0;
+        auto flush = [&](std::size_t end)
+        {
+            if (run_count > 0)
+                m_items.push_back({nullptr, units.subspan(run_begin, end - run_begin), run_offset});
+            run_begin = end;
+            run_count = 0;
+        };
+
+        for (std::size_t i = 0; i < units.size(); ++i)
+        {
+            const GameUnit& unit = *units[i];
+            const std::size_t mark = m_items.size();
+            const UnitGroup* child = unit.asGroup();
+            const std::size_t count = child ? split(*child, offset) : unit.unitCount();
+
+            if (count >= m_grain)
+            {
+                // Уже разбита рекурсивно (группа) или идёт отдельным заданием.
+                flush(i);
+                if (!child)
+                    m_items.push_back({&unit, {}, offset});
+                run_begin = i + 1;
+                run_offset = offset + count;
+            }
+            else
+            {
+                // Мелкое поддерево выполняется целиком в составе отрезка.
+                m_items.resize(mark);
+                if (run_count == 0)
+                {
+                    run_begin = i;
+                    run_offset = offset;
+                }
+                run_count += count;
+                if (run_count >= m_grain)
+                {
+                    flush(i + 1);
+                    run_offset = offset + count;
+                }
+            }
+
+            offset += count;
+        }
+        flush(units.size());
+
+        return offset - start;
+    }
+
+    std::vector<WorkItem> m_items;
+    std::size_t m_grain;
+    std::size_t m_size = 0;
+};
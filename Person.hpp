@@ -0,0 +1,101 @@
+#pragma once
+#include <cassert>
+#include <cstddef>
+#include <span>
+#include <string>
+#include <utility>
+#include <vector>
+
+class Builder;
+
+class Person
+{
+public:
+    Person() = default;
+
+    Person(std::string name, int age, int grade)
+        : m_name(std::move(name))
+        , m_age(age)
+        , m_grade(grade)
+    {}
+
+    const std::string& name() const { return m_name; }
+    int age()   const { return m_age; }
+    int grade() const { return m_grade; }
+
+private:
+    std::string m_name;
+    int m_age   = 0;
+    int m_grade = 0;
+
+    friend class Builder;
+};
+
+class Builder
+{
+public:
+    Builder() = default;
+
+    Builder& name(std::string name) &
+    {
+        m_person.m_name = std::move(name);
+        return *this;
+    }
+
+    Builder& age(int age) &
+    {
+        m_person.m_age = age;
+        return *this;
+    }
+
+    Builder& grade(int grade) &
+    {
+        m_person.m_grade = grade;
+        return *this;
+    }
+
+    // Цепочка на временном билдере остаётся rvalue и заканчивается build().
+    Builder&& name(std::string name) &&
+    {
+        return std::move(this->name(std::move(name)));
+    }
+
+    Builder&& age(int age) &&
+    {
+        return std::move(this->age(age));
+    }
+
+    Builder&& grade(int grade) &&
+    {
+        return std::move(this->grade(grade));
+    }
+
+    // Копия: билдер можно использовать повторно.
+    Person get() const
+    {
+        return m_person;
+    }
+
+    // Перемещение: имя не копируется, билдер после вызова не используется.
+    Person build() &&
+    {
+        return std::move(m_person);
+    }
+
+    // Пакетное построение из столбцов: записи создаются сразу в out,
+    // память резервируется один раз, имена перемещаются из names.
+    static void build_into(std::vector<Person>& out,
+                           std::span<std::string> names,
+                           std::span<const int> ages,
+                           std::span<const int> grades)
+    {
+        assert(names.size() == ages.size() && names.size() == grades.size());
+
+        out.reserve(out.size() + names.size());
+        for (std::size_t i = 0; i < names.size(); ++i)
+            out.emplace_back(std::move(names[i]), ages[i], grades[i]);
+    }
+
+private:
+    Person m_person;
+};
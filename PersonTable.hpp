@@ -0,0 +1,246 @@
+#pragma once
+#include "Person.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Столбцовое хранилище Person: имена лежат подряд в одной строке-арене
+// (строка i — [offsets[i], offsets[i + 1])), возраст и класс — плотные
+// массивы int. Для запросов по возрасту и классу поддерживаются
+// отсортированные индексы (номера строк, упорядоченные по значению).
+//
+// Индексы перестраиваются лениво при первом запросе после вставки;
+// одновременные запросы из нескольких потоков допустимы только
+// после явного build_indexes().
+
+class PersonTable
+{
+public:
+    using Row = std::uint32_t;
+
+    PersonTable() { m_offsets.push_back(0); }
+
+    std::size_t size() const { return m_ages.size(); }
+
+    void reserve(std::size_t rows, std::size_t name_bytes = 0)
+    {
+        m_names.reserve(name_bytes);
+        m_offsets.reserve(rows + 1);
+        m_ages.reserve(rows);
+        m_grades.reserve(rows);
+    }
+
+    // -------------------------------------------------
+
+    Row insert(std::string_view name, int age, int grade)
+    {
+        assert(size() < UINT32_MAX);
+
+        m_names.append(name);
+        m_offsets.push_back(m_names.size());
+        m_ages.push_back(age);
+        m_grades.push_back(grade);
+        m_indexed = false;
+        return static_cast<Row>(size() - 1);
+    }
+
+    Row insert(const Person& person)
+    {
+        return insert(person.name(), person.age(), person.grade());
+    }
+
+    void insert(std::span<const Person> people)
+    {
+        std::size_t bytes = 0;
+        for (const auto& person : people)
+            bytes += person.name().size();
+
+        reserve(size() + people.size(), m_names.size() + bytes);
+        for (const auto& person : people)
+            insert(person);
+    }
+
+    // Пакетная вставка из столбцов — тех же, что принимает Builder::build_into.
+    void insert(std::span<const std::string> names,
+                std::span<const int> ages,
+                std::span<const int> grades)
+    {
+        assert(names.size() == ages.size() && names.size() == grades.size());
+        assert(names.size() <= UINT32_MAX - size());
+
+        std::size_t bytes = 0;
+        for (const auto& name : names)
+            bytes += name.size();
+
+        reserve(size() + names.size(), m_names.size() + bytes);
+        for (std::size_t i = 0; i < names.size(); ++i)
+        {
+            m_names.append(names[i]);
+            m_offsets.push_back(m_names.size());
+        }
+        m_ages.insert(m_ages.end(), ages.begin(), ages.end());
+        m_grades.insert(m_grades.end(), grades.begin(), grades.end());
+        m_indexed = false;
+    }
+
+    // -------------------------------------------------
+
+    std::string_view name(Row row) const
+    {
+        return std::string_view(m_names).substr(m_offsets[row], m_offsets[row + 1] - m_offsets[row]);
+    }
+
+    int age(Row row)   const { return m_ages[row]; }
+    int grade(Row row) const { return m_grades[row]; }
+
+    Person person(Row row) const
+    {
+        return Person(std::string(name(row)), age(row), grade(row));
+    }
+
+    std::span<const int> ages()   const { return m_ages; }
+    std::span<const int> grades() const { return m_grades; }
+
+    // -------------------------------------------------
+
+    // Строки с lo <= age <= hi, упорядоченные по возрасту.
+    std::span<const Row> by_age(int lo, int hi) const
+    {
+        build_indexes();
+        return m_age_index.range(lo, hi);
+    }
+
+    std::span<const Row> by_grade(int lo, int hi) const
+    {
+        build_indexes();
+        return m_grade_index.range(lo, hi);
+    }
+
+    // Строки, попадающие в оба диапазона, упорядоченные по (возраст, класс).
+    // Внутри диапазона возрастов составной индекс для каждого возраста
+    // хранит строки, отсортированные по классу, — нужные участки находятся
+    // двоичным поиском и копируются целиком.
+    std::vector<Row> query(int age_lo, int age_hi, int grade_lo, int grade_hi) const
+    {
+        build_indexes();
+
+        std::vector<Row> result;
+        if (age_lo > age_hi || grade_lo > grade_hi)
+            return result;
+
+        const auto& ages   = m_age_grade_index.keys;
+        const auto& grades = m_age_grade_grades;
+        const auto& rows   = m_age_grade_index.rows;
+
+        auto first = std::lower_bound(ages.begin(), ages.end(), age_lo) - ages.begin();
+        auto last  = std::upper_bound(ages.begin() + first, ages.end(), age_hi) - ages.begin();
+
+        while (first < last)
+        {
+            auto age_end = std::upper_bound(ages.begin() + first, ages.begin() + last, ages[first]) - ages.begin();
+
+            auto from = std::lower_bound(grades.begin() + first, grades.begin() + age_end, grade_lo);
+            auto to   = std::upper_bound(from, grades.begin() + age_end, grade_hi);
+            result.insert(result.end(),
+                          rows.begin() + (from - grades.begin()),
+                          rows.begin() + (to - grades.begin()));
+            first = age_end;
+        }
+        return result;
+    }
+
+    void build_indexes() const
+    {
+        if (m_indexed)
+            return;
+
+        m_age_index.build(m_ages);
+        m_grade_index.build(m_grades);
+
+        // Устойчивая сортировка по возрасту строк, уже упорядоченных
+        // по классу, даёт порядок (возраст, класс).
+        m_age_grade_index.build(m_ages, m_grade_index.rows);
+        m_age_grade_grades.resize(size());
+        for (std::size_t i = 0; i < size(); ++i)
+            m_age_grade_grades[i] = m_grades[m_age_grade_index.rows[i]];
+
+        m_indexed = true;
+    }
+
+private:
+    // Номера строк, упорядоченные по значению столбца (устойчиво
+    // относительно порядка order), и сами значения в том же порядке —
+    // для двоичного поиска без обращений к столбцу вразброс.
+    struct SortedIndex
+    {
+        std::vector<Row> rows;
+        std::vector<int> keys;
+
+        void build(const std::vector<int>& column, std::span<const Row> order = {})
+        {
+            const std::size_t n = column.size();
+            rows.resize(n);
+            keys.resize(n);
+            if (n == 0)
+                return;
+
+            auto row_at = [&](std::size_t i) { return order.empty() ? static_cast<Row>(i) : order[i]; };
+
+            auto [min_it, max_it] = std::minmax_element(column.begin(), column.end());
+            const std::int64_t min = *min_it;
+            const std::int64_t span = std::int64_t(*max_it) - min + 1;
+
+            // Узкий диапазон значений (возраст, класс) — сортировка подсчётом за O(n).
+            if (span <= std::int64_t(n) + 1024)
+            {
+                std::vector<std::size_t> start(span + 1, 0);
+                for (int value : column)
+                    ++start[value - min + 1];
+                for (std::int64_t v = 0; v < span; ++v)
+                    start[v + 1] += start[v];
+                for (std::size_t i = 0; i < n; ++i)
+                {
+                    Row row = row_at(i);
+                    rows[start[column[row] - min]++] = row;
+                }
+            }
+            else
+            {
+                for (std::size_t i = 0; i < n; ++i)
+                    rows[i] = row_at(i);
+                std::stable_sort(rows.begin(), rows.end(),
+                                 [&](Row a, Row b) { return column[a] < column[b]; });
+            }
+
+            for (std::size_t i = 0; i < n; ++i)
+                keys[i] = column[rows[i]];
+        }
+
+        std::span<const Row> range(int lo, int hi) const
+        {
+            if (lo > hi)
+                return {};
+
+            auto first = std::lower_bound(keys.begin(), keys.end(), lo);
+            auto last  = std::upper_bound(first, keys.end(), hi);
+            return std::span<const Row>(rows).subspan(first - keys.begin(), last - first);
+        }
+    };
+
+    std::string m_names;
+    std::vector<std::size_t> m_offsets;
+    std::vector<int> m_ages;
+    std::vector<int> m_grades;
+
+    mutable SortedIndex m_age_index;
+    mutable SortedIndex m_grade_index;
+    mutable SortedIndex m_age_grade_index;
+    mutable std::vector<int> m_age_grade_grades;
+    mutable bool m_indexed = false;
+};
@@ -0,0 +1,116 @@
+#pragma once
+#include "Deque.hpp"
+
+#include <cassert>
+#include <cstddef>
+#include <span>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+// Разнородная коллекция сущностей E<B> для списка поведений
+// Deque<Bs...>: по непрерывному массиву на каждое поведение. Обход идёт
+// корзина за корзиной, и внутри корзины тип известен на этапе
+// компиляции — вызов attack() встраивается, как у одиночного E<B>,
+// без стирания типа и косвенных вызовов на элемент.
+//
+// Порядок сущностей — по поведениям в порядке списка, внутри корзины —
+// в порядке добавления (remove() его нарушает).
+
+template <template <typename> class E, typename Behaviors>
+class Population;
+
+template <template <typename> class E, typename... Bs>
+class Population<E, Deque<Bs...>>
+{
+public:
+    using behaviors = Deque<Bs...>;
+
+    static_assert(size_v<unique<behaviors>> == sizeof...(Bs), "Behaviors must be distinct");
+
+    template <typename B>
+    static constexpr bool holds_v = has_v<B, behaviors>;
+
+    // -------------------------------------------------
+
+    template <typename B, typename... Args>
+    E<B>& emplace(Args&&... args)
+    {
+        return bucket_vector<B>().emplace_back(std::forward<Args>(args)...);
+    }
+
+    template <typename B>
+    void reserve(std::size_t count) { bucket_vector<B>().reserve(count); }
+
+    // Удаление перестановкой последнего элемента корзины на место i.
+    template <typename B>
+    void remove(std::size_t i)
+    {
+        auto& items = bucket_vector<B>();
+        assert(i < items.size());
+        if (i + 1 != items.size())
+            items[i] = std::move(items.back());
+        items.pop_back();
+    }
+
+    void clear() { (bucket_vector<Bs>().clear(), ...); }
+
+    // -------------------------------------------------
+
+    template <typename B>
+    std::size_t size() const { return bucket<B>().size(); }
+
+    std::size_t size() const { return (size<Bs>() + ... + 0); }
+
+    bool empty() const { return size() == 0; }
+
+    template <typename B>
+    std::span<E<B>> bucket() { return bucket_vector<B>(); }
+
+    template <typename B>
+    std::span<const E<B>> bucket() const { return bucket_vector<B>(); }
+
+    // -------------------------------------------------
+
+    // f(std::span<E<B>>) для каждой корзины, по порядку поведений.
+    template <typename F>
+    void for_each_bucket(F&& f) { (f(bucket<Bs>()), ...); }
+
+    template <typename F>
+    void for_each_bucket(F&& f) const { (f(bucket<Bs>()), ...); }
+
+    // f(E<B>&) для каждой сущности; f инстанцируется отдельно для каждого B.
+    template <typename F>
+    void for_each(F&& f)
+    {
+        for_each_bucket([&](auto items) { for (auto& item : items) f(item); });
+    }
+
+    template <typename F>
+    void for_each(F&& f) const
+    {
+        for_each_bucket([&](auto items) { for (const auto& item : items) f(item); });
+    }
+
+    void attack_all()
+    {
+        for_each([](auto& item) { item.attack(); });
+    }
+
+private:
+    template <typename B>
+    std::vector<E<B>>& bucket_vector()
+    {
+        static_assert(holds_v<B>, "Behavior is not in this population");
+        return std::get<index_of_v<B, behaviors>>(m_buckets);
+    }
+
+    template <typename B>
+    const std::vector<E<B>>& bucket_vector() const
+    {
+        static_assert(holds_v<B>, "Behavior is not in this population");
+        return std::get<index_of_v<B, behaviors>>(m_buckets);
+    }
+
+    std::tuple<std::vector<E<Bs>>...> m_buckets;
+};
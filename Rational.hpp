@@ -0,0 +1,435 @@
+#pragma once
+#include "Instrument.hpp"
+
+#include <cassert>
+#include <compare>
+#include <cstdint>
+#include <istream>
+#include <limits>
+#include <ostream>
+#include <type_traits>
+#include <utility>
+
+// Рациональное число над знаковым целым Int (std::int64_t, __int128 или
+// BigInt — см. BigRational.hpp).
+// Инвариант: знаменатель положителен, дробь несократима, поэтому
+// равенство — сравнение полей, а сокращать приходится только то, что
+// реально могло стать сократимым:
+//   *  — перекрёстное сокращение до умножения (числитель одной дроби
+//        со знаменателем другой), результат сразу несократим;
+//   +  — через gcd знаменателей (Кнут, т. 2, 4.5.1), промежуточные
+//        значения не больше итоговых;
+//   <=> — произведения в удвоенной разрядности, без переполнения.
+// НОД — двоичный (Штейн) на __builtin_ctz. Переполнение самого
+// результата проверяется assert.
+//
+// Тип Int подключается специализацией Traits: Unsigned — модуль, Wide —
+// тип для точных произведений, bounded — есть ли переполнение. Для
+// неограниченных типов (bounded == false) НОД ищется через ADL
+// (gcd(a, b) в пространстве имён типа), ввод-вывод — операторами потока.
+
+namespace rational_detail
+{
+
+template <typename Int>
+struct Traits;
+
+template <>
+struct Traits<std::int32_t>
+{
+    using Unsigned = std::uint32_t;
+    using Wide = std::int64_t;
+    static constexpr bool bounded = true;
+};
+
+template <>
+struct Traits<std::int64_t>
+{
+    using Unsigned = std::uint64_t;
+    using Wide = __int128;
+    static constexpr bool bounded = true;
+};
+
+// Для __int128 удвоенной разрядности нет: произведения сравниваются
+// по 64-битным половинам (mul_compare ниже).
+template <>
+struct Traits<__int128>
+{
+    using Unsigned = unsigned __int128;
+    using Wide = void;
+    static constexpr bool bounded = true;
+};
+
+inline int ctz(std::uint32_t x) { return __builtin_ctz(x); }
+inline int ctz(std::uint64_t x) { return __builtin_ctzll(x); }
+
+inline int ctz(unsigned __int128 x)
+{
+    const auto low = static_cast<std::uint64_t>(x);
+    return low ? __builtin_ctzll(low) : 64 + __builtin_ctzll(static_cast<std::uint64_t>(x >> 64));
+}
+
+// Двоичный алгоритм Штейна: только сдвиги и вычитания, без деления.
+template <typename U>
+U binary_gcd(U u, U v)
+{
+    if (u == 0)
+        return v;
+    if (v == 0)
+        return u;
+
+    // Меньшее и разность вместо обмена по условию — компилятор
+    // выбирает cmov, и непредсказуемого ветвления в цикле нет.
+    const int shift = ctz(u | v);
+    u >>= ctz(u);
+    do
+    {
+        v >>= ctz(v);
+        const U low = u < v ? u : v;
+        v = (u < v ? v : u) - low;
+        u = low;
+    } while (v != 0);
+
+    return u << shift;
+}
+
+template <typename Int>
+typename Traits<Int>::Unsigned magnitude(Int x)
+{
+    using U = typename Traits<Int>::Unsigned;
+    return x < 0 ? U(0) - U(x) : U(x);
+}
+
+template <typename Int>
+Int gcd(Int a, Int b)
+{
+    INSTRUMENT_COUNT("rational.gcd");
+    return static_cast<Int>(binary_gcd(magnitude(a), magnitude(b)));
+}
+
+// Полное 256-битное произведение двух 128-битных модулей: (high, low).
+inline std::pair<unsigned __int128, unsigned __int128> mul_wide(unsigned __int128 a, unsigned __int128 b)
+{
+    using U = unsigned __int128;
+    const U mask = ~std::uint64_t(0);
+
+    const U a0 = a & mask, a1 = a >> 64;
+    const U b0 = b & mask, b1 = b >> 64;
+
+    const U p00 = a0 * b0, p01 = a0 * b1, p10 = a1 * b0, p11 = a1 * b1;
+    const U middle = (p00 >> 64) + (p01 & mask) + (p10 & mask);
+
+    const U low = (middle << 64) | (p00 & mask);
+    const U high = p11 + (p01 >> 64) + (p10 >> 64) + (middle >> 64);
+    return {high, low};
+}
+
+// Сравнение a * b и c * d без переполнения.
+template <typename Int>
+std::strong_ordering mul_compare(const Int& a, const Int& b, const Int& c, const Int& d)
+{
+    using Wide = typename Traits<Int>::Wide;
+
+    if constexpr (!std::is_void_v<Wide>)
+        return Wide(a) * b <=> Wide(c) * d;
+    else
+    {
+        // Все множители меньше 2^63 — произведения помещаются в Int.
+        if (((magnitude(a) | magnitude(b) | magnitude(c) | magnitude(d)) >> 63) == 0)
+            return a * b <=> c * d;
+
+        const int left = (a > 0) - (a < 0), right = (c > 0) - (c < 0);
+        const int left_sign = left * ((b > 0) - (b < 0));
+        const int right_sign = right * ((d > 0) - (d < 0));
+        if (left_sign != right_sign || left_sign == 0)
+            return left_sign <=> right_sign;
+
+        const auto lhs = mul_wide(magnitude(a), magnitude(b));
+        const auto rhs = mul_wide(magnitude(c), magnitude(d));
+        return left_sign > 0 ? lhs <=> rhs : rhs <=> lhs;
+    }
+}
+
+template <typename Int>
+Int checked_mul(const Int& a, const Int& b)
+{
+    if constexpr (!Traits<Int>::bounded)
+        return a * b;
+    else
+    {
+        Int result;
+        [[maybe_unused]] const bool overflow = __builtin_mul_overflow(a, b, &result);
+        assert(!overflow && "Rational overflow");
+        return result;
+    }
+}
+
+template <typename Int>
+Int checked_add(const Int& a, const Int& b)
+{
+    if constexpr (!Traits<Int>::bounded)
+        return a + b;
+    else
+    {
+        Int result;
+        [[maybe_unused]] const bool overflow = __builtin_add_overflow(a, b, &result);
+        assert(!overflow && "Rational overflow");
+        return result;
+    }
+}
+
+// -min не представимо.
+template <typename Int>
+Int checked_neg(const Int& a)
+{
+    if constexpr (!Traits<Int>::bounded)
+        return -a;
+    else
+    {
+        Int result;
+        [[maybe_unused]] const bool overflow = __builtin_sub_overflow(Int(0), a, &result);
+        assert(!overflow && "Rational overflow");
+        return result;
+    }
+}
+
+// Ввод и вывод __int128 — у стандартных потоков их нет.
+template <typename Int>
+std::ostream& write_int(std::ostream& os, const Int& value)
+{
+    if constexpr (!Traits<Int>::bounded)
+        return os << value;
+    else if constexpr (sizeof(Int) <= sizeof(long long))
+        return os << static_cast<long long>(value);
+    else
+    {
+        char digits[48];
+        char* p = digits + sizeof(digits);
+        auto u = magnitude(value);
+        do
+        {
+            *--p = char('0' + u % 10);
+            u /= 10;
+        } while (u != 0);
+        if (value < 0)
+            *--p = '-';
+        return os.write(p, digits + sizeof(digits) - p);
+    }
+}
+
+template <typename Int>
+std::istream& read_int(std::istream& is, Int& value)
+{
+    if constexpr (!Traits<Int>::bounded)
+        return is >> value;
+    else if constexpr (sizeof(Int) <= sizeof(long long))
+    {
+        long long v;
+        if (is >> v)
+            value = static_cast<Int>(v);
+        return is;
+    }
+    else
+    {
+        char c;
+        if (!(is >> c))
+            return is;
+
+        const bool negative = c == '-';
+        if (negative || c == '+')
+            c = static_cast<char>(is.get());
+
+        if (c < '0' || c > '9')
+        {
+            is.setstate(std::ios::failbit);
+            return is;
+        }
+
+        using U = typename Traits<Int>::Unsigned;
+        U u = 0;
+        while (true)
+        {
+            u = u * 10 + U(c - '0');
+            const int next = is.peek();
+            if (next < '0' || next > '9')
+                break;
+            c = static_cast<char>(is.get());
+        }
+        value = negative ? Int(U(0) - u) : Int(u);
+        return is;
+    }
+}
+
+} // namespace rational_detail
+
+//////////////////////////////////////////////////////////////////
+
+template <typename Int>
+class Rational
+{
+    using Traits = typename rational_detail::Traits<Int>;
+
+public:
+    using value_type = Int;
+
+    constexpr Rational() = default;
+
+    constexpr Rational(Int num) : m_num(num) {}
+
+    Rational(Int num, Int den) : m_num(num), m_den(den)
+    {
+        assert(den != 0 && "Rational with zero denominator");
+        normalize();
+    }
+
+    // Дробь из уже сокращённых числителя и знаменателя (den > 0) —
+    // без поиска НОД; для столбцов и разборщиков, где инвариант
+    // обеспечен заранее.
+    static Rational from_reduced(Int num, Int den)
+    {
+        assert(den > 0);
+        Rational r;
+        r.m_num = num;
+        r.m_den = den;
+        return r;
+    }
+
+    Int numerator()   const { return m_num; }
+    Int denominator() const { return m_den; }
+
+    explicit operator double() const { return static_cast<double>(m_num) / static_cast<double>(m_den); }
+
+    // -------------------------------------------------
+
+    Rational& operator+=(const Rational& other)
+    {
+        using namespace rational_detail;
+
+        if (m_den == other.m_den)
+        {
+            // Частый случай: общий знаменатель (в том числе целые числа).
+            m_num = checked_add(m_num, other.m_num);
+            if (m_den != 1)
+                normalize();
+            return *this;
+        }
+
+        const Int g = gcd(m_den, other.m_den);
+        if (g == 1)
+        {
+            m_num = checked_add(checked_mul(m_num, other.m_den), checked_mul(other.m_num, m_den));
+            m_den = checked_mul(m_den, other.m_den);
+            return *this;
+        }
+
+        const Int t = checked_add(checked_mul(m_num, other.m_den / g), checked_mul(other.m_num, m_den / g));
+        const Int g2 = gcd(t, g);
+        m_num = t / g2;
+        m_den = checked_mul(m_den / g, other.m_den / g2);
+        return *this;
+    }
+
+    Rational& operator-=(const Rational& other) { return *this += -other; }
+
+    Rational& operator*=(const Rational& other)
+    {
+        using namespace rational_detail;
+
+        const Int g1 = gcd(m_num, other.m_den);
+        const Int g2 = gcd(other.m_num, m_den);
+        m_num = checked_mul(m_num / g1, other.m_num / g2);
+        m_den = checked_mul(m_den / g2, other.m_den / g1);
+        return *this;
+    }
+
+    Rational& operator/=(const Rational& other)
+    {
+        assert(other.m_num != 0 && "Rational division by zero");
+        return *this *= other.reciprocal();
+    }
+
+    Rational& operator++() { m_num = rational_detail::checked_add(m_num, m_den); return *this; }
+    Rational& operator--() { m_num = rational_detail::checked_add(m_num, Int(-m_den)); return *this; }
+    Rational operator++(int) { Rational t = *this; ++*this; return t; }
+    Rational operator--(int) { Rational t = *this; --*this; return t; }
+
+    Rational operator-() const
+    {
+        Rational r = *this;
+        r.m_num = rational_detail::checked_neg(r.m_num);
+        return r;
+    }
+
+    Rational reciprocal() const
+    {
+        assert(m_num != 0);
+        Rational r;
+        r.m_num = m_num < 0 ? rational_detail::checked_neg(m_den) : m_den;
+        r.m_den = m_num < 0 ? rational_detail::checked_neg(m_num) : m_num;
+        return r;
+    }
+
+    friend Rational operator+(Rational lhs, const Rational& rhs) { return lhs += rhs; }
+    friend Rational operator-(Rational lhs, const Rational& rhs) { return lhs -= rhs; }
+    friend Rational operator*(Rational lhs, const Rational& rhs) { return lhs *= rhs; }
+    friend Rational operator/(Rational lhs, const Rational& rhs) { return lhs /= rhs; }
+
+    // -------------------------------------------------
+
+    friend bool operator==(const Rational& lhs, const Rational& rhs)
+    {
+        return lhs.m_num == rhs.m_num && lhs.m_den == rhs.m_den;
+    }
+
+    friend std::strong_ordering operator<=>(const Rational& lhs, const Rational& rhs)
+    {
+        if (lhs.m_den == rhs.m_den)
+            return lhs.m_num <=> rhs.m_num;
+        return rational_detail::mul_compare(lhs.m_num, rhs.m_den, rhs.m_num, lhs.m_den);
+    }
+
+    // -------------------------------------------------
+
+    friend std::ostream& operator<<(std::ostream& os, const Rational& r)
+    {
+        rational_detail::write_int(os, r.m_num);
+        os << '/';
+        return rational_detail::write_int(os, r.m_den);
+    }
+
+    friend std::istream& operator>>(std::istream& is, Rational& r)
+    {
+        Int num = 0, den = 1;
+        char slash = 0;
+        if (rational_detail::read_int(is, num) && is >> slash && rational_detail::read_int(is, den))
+        {
+            if (slash != '/' || den == 0)
+                is.setstate(std::ios::failbit);
+            else
+                r = Rational(num, den);
+        }
+        return is;
+    }
+
+private:
+    void normalize()
+    {
+        using namespace rational_detail;
+
+        if (m_den < 0)
+        {
+            m_num = checked_neg(m_num);
+            m_den = checked_neg(m_den);
+        }
+
+        const Int g = gcd(m_num, m_den);
+        if (g != 1)
+        {
+            m_num /= g;
+            m_den /= g;
+        }
+    }
+
+    Int m_num = 0;
+    Int m_den = 1;
+};
@@ -0,0 +1,329 @@
+#pragma once
+#include "Rational.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+// Столбец дробей в виде SoA: отдельные массивы числителей и
+// знаменателей, инвариант тот же, что у Rational (знаменатель
+// положителен, дробь несократима). Пакетные операции над столбцами
+// (add, mul, compare, to_double) идут блоками по block элементов,
+// и каждый проход внутри блока — цикл без ветвлений по всем элементам:
+//   — перекрёстные произведения в удвоенной разрядности;
+//   — двоичный НОД «в ногу»: каждый проход делает один шаг Штейна сразу
+//     для всех элементов (вместо ctz — сдвиг на один бит), пока во всех
+//     не кончится;
+//   — точное деление на НОД для Int = std::int32_t — через double:
+//     частное, помещающееся в 32 бита, восстанавливается без ошибки.
+// Для std::int32_t компилятор векторизует эти проходы уже на -O2, но
+// НОД в add идёт по 64-битным произведениям, а сравнения 64-битных
+// чисел в SSE2 нет — add выигрывает только с AVX2 (-march=native).
+// std::int64_t с __int128 работает по тем же формулам, но поэлементно.
+//
+// Результат, не помещающийся в Int, — assert, как у Rational.
+
+namespace rational_detail
+{
+
+// Все проходы — ровно по block элементов: GCC на -O2 векторизует
+// только циклы с известным числом итераций. Хвост столбца дополняется
+// нейтральными дробями 0/1.
+inline constexpr std::size_t block = 256;
+
+// u[i] = gcd(u[i], v[i]); u[i] != 0.
+template <typename U>
+void gcd_lanes(U (&__restrict u)[block], U (&__restrict v)[block])
+{
+    constexpr int bits = sizeof(U) * 8;
+
+    // Общая степень двойки: младший единичный бит u | v.
+    U low[block];
+    for (std::size_t i = 0; i < block; ++i)
+    {
+        const U x = u[i] | v[i];
+        low[i] = x & (U(0) - x);
+    }
+
+    // Нечётная часть u.
+    for (int step = 0; step < bits; ++step)
+    {
+        U even = 0;
+        for (std::size_t i = 0; i < block; ++i)
+        {
+            even |= ~u[i] & 1;
+            u[i] = u[i] & 1 ? u[i] : u[i] >> 1;
+        }
+        if (even == 0)
+            break;
+    }
+
+    // u нечётно: чётное v делится пополам, нечётное — заменяется
+    // полуразностью, меньшее остаётся в u.
+    for (int step = 0; step < 2 * bits; ++step)
+    {
+        U rest = 0;
+        for (std::size_t i = 0; i < block; ++i)
+        {
+            const U a = u[i], b = v[i];
+            const U lo = a < b ? a : b, hi = a < b ? b : a;
+            const U odd = U(0) - (b & 1);
+            u[i] = (lo & odd) | (a & ~odd);
+            v[i] = (((hi - lo) & odd) | (b & ~odd)) >> 1;
+            rest |= v[i];
+        }
+        if (rest == 0)
+            break;
+    }
+
+    for (std::size_t i = 0; i < block; ++i)
+        u[i] *= low[i];
+}
+
+// q[i] = n[i] / g[i] при делении нацело; возвращает ненулевое значение,
+// если какое-то частное не помещается в Int.
+template <typename Int, typename Wide, typename U>
+Wide exact_quotients(const Wide (&n)[block], const U (&g)[block], Int (&q)[block])
+{
+    Wide bad = 0;
+    for (std::size_t i = 0; i < block; ++i)
+    {
+        if constexpr (sizeof(Int) == 4 && sizeof(Wide) == 8)
+        {
+            // Если частное помещается в int32, погрешность
+            // double(n) / double(g) меньше 2^-20 — округление до
+            // ближайшего даёт его точно.
+            double x = double(n[i]) / double(g[i]);
+            x = x < -2147483648.0 ? -2147483648.0 : x > 2147483647.0 ? 2147483647.0 : x;
+            q[i] = Int(x + (x < 0 ? -0.5 : 0.5));
+        }
+        else
+            q[i] = Int(n[i] / Wide(g[i]));
+        bad |= Wide(q[i]) * Wide(g[i]) ^ n[i];
+    }
+    return bad;
+}
+
+// Блок [at, at + count) столбца в локальные массивы, хвост — 0/1.
+template <typename Int>
+void load_block(const Int* num, const Int* den, std::size_t count, Int (&n)[block], Int (&d)[block])
+{
+    std::copy(num, num + count, n);
+    std::copy(den, den + count, d);
+    std::fill(n + count, n + block, Int(0));
+    std::fill(d + count, d + block, Int(1));
+}
+
+} // namespace rational_detail
+
+//////////////////////////////////////////////////////////////////
+
+template <typename Int>
+class RationalColumn
+{
+public:
+    using value_type = Rational<Int>;
+
+    RationalColumn() = default;
+
+    explicit RationalColumn(std::size_t size) : m_num(size, 0), m_den(size, 1) {}
+
+    explicit RationalColumn(std::span<const Rational<Int>> values) { assign(values); }
+
+    void assign(std::span<const Rational<Int>> values)
+    {
+        m_num.resize(values.size());
+        m_den.resize(values.size());
+        for (std::size_t i = 0; i < values.size(); ++i)
+        {
+            m_num[i] = values[i].numerator();
+            m_den[i] = values[i].denominator();
+        }
+    }
+
+    std::vector<Rational<Int>> to_vector() const
+    {
+        std::vector<Rational<Int>> values;
+        values.reserve(size());
+        for (std::size_t i = 0; i < size(); ++i)
+            values.push_back((*this)[i]);
+        return values;
+    }
+
+    // -------------------------------------------------
+
+    std::size_t size() const { return m_num.size(); }
+
+    void resize(std::size_t size)
+    {
+        m_num.resize(size, 0);
+        m_den.resize(size, 1);
+    }
+
+    void reserve(std::size_t size)
+    {
+        m_num.reserve(size);
+        m_den.reserve(size);
+    }
+
+    void push_back(const Rational<Int>& value)
+    {
+        m_num.push_back(value.numerator());
+        m_den.push_back(value.denominator());
+    }
+
+    Rational<Int> operator[](std::size_t i) const { return Rational<Int>::from_reduced(m_num[i], m_den[i]); }
+
+    void set(std::size_t i, const Rational<Int>& value)
+    {
+        m_num[i] = value.numerator();
+        m_den[i] = value.denominator();
+    }
+
+    std::span<const Int> numerators()   const { return m_num; }
+    std::span<const Int> denominators() const { return m_den; }
+
+    // Запись в обход инварианта — для пакетных операций.
+    Int* numerators_data()   { return m_num.data(); }
+    Int* denominators_data() { return m_den.data(); }
+
+private:
+    std::vector<Int> m_num;
+    std::vector<Int> m_den;
+};
+
+//////////////////////////////////////////////////////////////////
+
+// out = a + b. out может совпадать с a или b.
+template <typename Int>
+void add(const RationalColumn<Int>& a, const RationalColumn<Int>& b, RationalColumn<Int>& out)
+{
+    using namespace rational_detail;
+    using Wide = typename Traits<Int>::Wide;
+    using U = typename Traits<Wide>::Unsigned;
+
+    assert(a.size() == b.size());
+    const std::size_t size = a.size();
+    out.resize(size);
+
+    Int an[block], ad[block], bn[block], bd[block], qn[block], qd[block];
+    Wide num[block], den[block];
+    U g[block], m[block];
+    Wide bad = 0;
+
+    for (std::size_t at = 0; at < size; at += block)
+    {
+        const std::size_t count = std::min(block, size - at);
+        load_block(a.numerators().data() + at, a.denominators().data() + at, count, an, ad);
+        load_block(b.numerators().data() + at, b.denominators().data() + at, count, bn, bd);
+
+        for (std::size_t i = 0; i < block; ++i)
+        {
+            num[i] = Wide(an[i]) * bd[i] + Wide(bn[i]) * ad[i];
+            den[i] = Wide(ad[i]) * bd[i];
+            g[i] = U(den[i]);
+            m[i] = num[i] < 0 ? U(0) - U(num[i]) : U(num[i]);
+        }
+
+        gcd_lanes(g, m);
+        bad |= exact_quotients(num, g, qn);
+        bad |= exact_quotients(den, g, qd);
+
+        std::copy(qn, qn + count, out.numerators_data() + at);
+        std::copy(qd, qd + count, out.denominators_data() + at);
+    }
+    assert(bad == 0 && "Rational overflow");
+}
+
+// out = a * b с перекрёстным сокращением, как Rational::operator*=.
+template <typename Int>
+void mul(const RationalColumn<Int>& a, const RationalColumn<Int>& b, RationalColumn<Int>& out)
+{
+    using namespace rational_detail;
+    using Wide = typename Traits<Int>::Wide;
+    using U = typename Traits<Int>::Unsigned;
+
+    assert(a.size() == b.size());
+    const std::size_t size = a.size();
+    out.resize(size);
+
+    Int an[block], ad[block], bn[block], bd[block];
+    Int an1[block], ad2[block], bn2[block], bd1[block];
+    Wide wide[block];
+    U g1[block], m1[block], g2[block], m2[block];
+    Wide bad = 0;
+
+    for (std::size_t at = 0; at < size; at += block)
+    {
+        const std::size_t count = std::min(block, size - at);
+        load_block(a.numerators().data() + at, a.denominators().data() + at, count, an, ad);
+        load_block(b.numerators().data() + at, b.denominators().data() + at, count, bn, bd);
+
+        // g1 = gcd(a.num, b.den), g2 = gcd(b.num, a.den)
+        for (std::size_t i = 0; i < block; ++i)
+        {
+            g1[i] = U(bd[i]);
+            m1[i] = an[i] < 0 ? U(0) - U(an[i]) : U(an[i]);
+            g2[i] = U(ad[i]);
+            m2[i] = bn[i] < 0 ? U(0) - U(bn[i]) : U(bn[i]);
+        }
+        gcd_lanes(g1, m1);
+        gcd_lanes(g2, m2);
+
+        auto divide = [&](const Int (&x)[block], const U (&g)[block], Int (&q)[block])
+        {
+            for (std::size_t i = 0; i < block; ++i)
+                wide[i] = x[i];
+            bad |= exact_quotients(wide, g, q);
+        };
+        divide(an, g1, an1);
+        divide(bd, g1, bd1);
+        divide(bn, g2, bn2);
+        divide(ad, g2, ad2);
+
+        Int* on = out.numerators_data() + at;
+        Int* od = out.denominators_data() + at;
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            const Wide num = Wide(an1[i]) * bn2[i], den = Wide(ad2[i]) * bd1[i];
+            on[i] = Int(num);
+            od[i] = Int(den);
+            bad |= (Wide(Int(num)) ^ num) | (Wide(Int(den)) ^ den);
+        }
+    }
+    assert(bad == 0 && "Rational overflow");
+}
+
+// out[i] = -1, 0, 1 — знак a[i] - b[i].
+template <typename Int>
+void compare(const RationalColumn<Int>& a, const RationalColumn<Int>& b, std::span<std::int8_t> out)
+{
+    using Wide = typename rational_detail::Traits<Int>::Wide;
+
+    assert(a.size() == b.size() && out.size() == a.size());
+
+    const Int* an = a.numerators().data();
+    const Int* ad = a.denominators().data();
+    const Int* bn = b.numerators().data();
+    const Int* bd = b.denominators().data();
+
+    for (std::size_t i = 0; i < a.size(); ++i)
+    {
+        const Wide left = Wide(an[i]) * bd[i], right = Wide(bn[i]) * ad[i];
+        out[i] = std::int8_t((left > right) - (left < right));
+    }
+}
+
+template <typename Int>
+void to_double(const RationalColumn<Int>& a, std::span<double> out)
+{
+    assert(out.size() == a.size());
+
+    const Int* an = a.numerators().data();
+    const Int* ad = a.denominators().data();
+    for (std::size_t i = 0; i < a.size(); ++i)
+        out[i] = double(an[i]) / double(ad[i]);
+}
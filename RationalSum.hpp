@@ -0,0 +1,238 @@
+#pragma once
+#include "Rational.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// Сумма многих дробей с отложенным сокращением. Rational::operator+=
+// ищет НОД на каждом сложении; RationalSum складывает «вслепую»:
+//   a/b + c/d = (a·d + c·b) / (b·d),
+// числитель и знаменатель копятся в удвоенной разрядности (Acc),
+// а сокращение выполняется, только когда очередное произведение
+// переполнило бы Acc, и при чтении результата (value()). Для BigInt
+// переполнения нет — там сокращение раз в unbounded_batch сложений,
+// чтобы числа не росли без предела.
+//
+// Для Int не шире 64 бит ещё и кэш множителей: если знаменатель
+// слагаемого d делит накопленный D, числитель прибавляется с множителем
+// D / d, и знаменатель не растёт. Множитель считается один раз на d
+// и годен, пока D не изменился (m_epoch). Для столбцов с небольшим
+// набором знаменателей (цены, доли) почти все сложения идут так.
+//
+// sum(span) — попарное сложение: блоки по block_size дробей
+// накапливаются так же, а суммы блоков объединяются деревом, как
+// в двоичном счётчике, — слагаемые на каждом уровне одного размера.
+
+template <typename Int>
+class RationalSum
+{
+    using Wide = typename rational_detail::Traits<Int>::Wide;
+
+public:
+    using Acc = std::conditional_t<std::is_void_v<Wide>, Int, Wide>;
+
+    static constexpr unsigned unbounded_batch = 32;
+
+    RationalSum() = default;
+
+    RationalSum& operator+=(const Rational<Int>& r)
+    {
+        if constexpr (cached)
+            if (add_scaled(r.numerator(), r.denominator()))
+                return *this;
+
+        add(Acc(r.numerator()), Acc(r.denominator()));
+        return *this;
+    }
+
+    RationalSum& operator+=(const RationalSum& other)
+    {
+        add(other.m_num, other.m_den);
+        return *this;
+    }
+
+    // Сокращённая сумма; assert, если она не помещается в Rational<Int>.
+    Rational<Int> value()
+    {
+        normalize();
+        if constexpr (!std::is_same_v<Acc, Int>)
+        {
+            assert(m_num == Acc(Int(m_num)) && m_den == Acc(Int(m_den)) && "Rational overflow");
+        }
+        return Rational<Int>(Int(m_num), Int(m_den));
+    }
+
+    void normalize()
+    {
+        using namespace rational_detail;
+
+        m_pending = 0;
+        if (m_num == 0)
+        {
+            // Знаменатель меняется — множители из кэша больше не годны.
+            if (m_den != 1)
+            {
+                m_den = 1;
+                ++m_epoch;
+            }
+            return;
+        }
+
+        const Acc g = gcd(m_num, m_den);
+        if (g != 1)
+        {
+            m_num /= g;
+            m_den /= g;
+            ++m_epoch;
+        }
+    }
+
+private:
+    static constexpr bool bounded = rational_detail::Traits<Acc>::bounded;
+    static constexpr bool cached = bounded && sizeof(Int) <= sizeof(std::uint64_t);
+
+    struct Scale
+    {
+        Int den = 0;
+        Int factor = 0;
+        std::uint64_t epoch = 0;
+    };
+
+    // num/den с den | m_den: m_num += num · (m_den / den).
+    bool add_scaled(Int num, Int den)
+    {
+        Scale& scale = m_scales[std::uint64_t(den) * 0x9E3779B97F4A7C15ull >> 60];
+        if (scale.den != den || scale.epoch != m_epoch)
+        {
+            if (m_den != Acc(Int(m_den)) || Int(m_den) % den != 0)
+                return false;
+            scale = {den, Int(Int(m_den) / den), m_epoch};
+        }
+
+        Acc n;
+        if (__builtin_add_overflow(m_num, Acc(num) * scale.factor, &n))
+            return false;
+        m_num = n;
+        return true;
+    }
+
+    void add(const Acc& num, const Acc& den)
+    {
+        if (try_add(num, den))
+        {
+            if constexpr (!bounded)
+                if (++m_pending == unbounded_batch)
+                    normalize();
+            return;
+        }
+
+        normalize();
+        if (try_add(num, den))
+            return;
+
+        // Даже сокращённая сумма не откладывается — точное сложение
+        // через НОД знаменателей, как в Rational.
+        if constexpr (bounded)
+        {
+            const Rational<Acc> sum = Rational<Acc>(m_num, m_den) + Rational<Acc>(num, den);
+            m_num = sum.numerator();
+            m_den = sum.denominator();
+            ++m_epoch;
+        }
+    }
+
+    // Сложение без сокращения; false (и состояние не тронуто), если
+    // какое-то произведение переполняет Acc.
+    bool try_add(const Acc& num, const Acc& den)
+    {
+        if constexpr (!bounded)
+        {
+            if (den == m_den)
+                m_num += num;
+            else
+            {
+                m_num = m_num * den + num * m_den;
+                m_den *= den;
+            }
+            return true;
+        }
+        else
+        {
+            Acc n;
+            if (den == m_den)
+            {
+                if (__builtin_add_overflow(m_num, num, &n))
+                    return false;
+                m_num = n;
+                return true;
+            }
+
+            Acc left, right, d;
+            if (__builtin_mul_overflow(m_num, den, &left) || __builtin_mul_overflow(num, m_den, &right) ||
+                __builtin_add_overflow(left, right, &n) || __builtin_mul_overflow(m_den, den, &d))
+                return false;
+
+            m_num = n;
+            m_den = d;
+            ++m_epoch;
+            return true;
+        }
+    }
+
+    Acc m_num = 0;
+    Acc m_den = 1;
+    unsigned m_pending = 0;
+    std::uint64_t m_epoch = 1;
+    Scale m_scales[cached ? 16 : 1];
+};
+
+//////////////////////////////////////////////////////////////////
+
+template <typename Int>
+Rational<Int> sum(std::span<const Rational<Int>> values)
+{
+    // Для BigInt блоки короче: внутри блока слагаемые растут без
+    // сокращения, и дерево важнее. Фиксированным типам длинный блок
+    // даёт больше попаданий в кэш множителей.
+    constexpr std::size_t block_size = rational_detail::Traits<Int>::bounded ? 1024 : 64;
+
+    // stack[level] — сумма 2^level блоков; перенос как в двоичном счётчике.
+    RationalSum<Int> stack[64];
+    std::size_t occupied = 0;
+
+    for (std::size_t at = 0; at < values.size(); at += block_size)
+    {
+        RationalSum<Int> block;
+        const std::size_t end = std::min(values.size(), at + block_size);
+        for (std::size_t i = at; i < end; ++i)
+            block += values[i];
+
+        std::size_t level = 0;
+        for (; occupied >> level & 1; ++level)
+        {
+            stack[level] += block;
+            block = std::move(stack[level]);
+            stack[level] = RationalSum<Int>();
+        }
+        stack[level] = std::move(block);
+        occupied += 1;
+    }
+
+    RationalSum<Int> total;
+    for (std::size_t level = 0; level < 64; ++level)
+        if (occupied >> level & 1)
+            total += stack[level];
+    return total.value();
+}
+
+template <typename Int>
+Rational<Int> sum(const std::vector<Rational<Int>>& values)
+{
+    return sum(std::span<const Rational<Int>>(values));
+}
@@ -0,0 +1,210 @@
+#pragma once
+#include "Rational.hpp"
+#include "RationalColumn.hpp"
+
+#include <cerrno>
+#include <charconv>
+#include <cstddef>
+#include <cstring>
+#include <system_error>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// Разбор и запись дробей по образцу std::from_chars / std::to_chars:
+// прямо по буферу, без потоков, локалей и выделения памяти.
+//
+// Формат: целое со знаком '-' (необязательным), затем необязательно
+// '/' и знаменатель, тоже со знаком: "3", "-10/20", "7/-14". Пробелы
+// не пропускаются; знаменатель 0 и пустые части — invalid_argument,
+// числитель или знаменатель вне Int — result_out_of_range. Результат
+// сокращается так же, как конструктором Rational(num, den).
+// to_chars всегда пишет "num/den" — это читают и from_chars, и operator>>.
+//
+// parse_column — все дроби текста через пробельные символы в столбец;
+// load_column — то же для файла, отображённого в память (mmap).
+
+namespace rational_detail
+{
+
+template <typename Int>
+std::from_chars_result parse_int(const char* first, const char* last, Int& value)
+{
+    using U = typename Traits<Int>::Unsigned;
+
+    const char* p = first;
+    const bool negative = p != last && *p == '-';
+    p += negative;
+
+    const char* digits = p;
+    U u = 0;
+    bool overflow = false;
+    for (; p != last && unsigned(*p - '0') < 10; ++p)
+        overflow |= __builtin_mul_overflow(u, U(10), &u) | __builtin_add_overflow(u, U(*p - '0'), &u);
+
+    if (p == digits)
+        return {first, std::errc::invalid_argument};
+
+    // Модуль отрицательного числа может быть на единицу больше.
+    const U limit = U(~U(0) >> 1) + negative;
+    if (overflow || u > limit)
+        return {p, std::errc::result_out_of_range};
+
+    value = negative ? Int(U(0) - u) : Int(u);
+    return {p, std::errc{}};
+}
+
+// Конец записанного или nullptr, если не хватило места.
+template <typename Int>
+char* format_int(char* first, char* last, Int value)
+{
+    if constexpr (sizeof(Int) <= sizeof(long long))
+    {
+        const std::to_chars_result result = std::to_chars(first, last, value);
+        return result.ec == std::errc{} ? result.ptr : nullptr;
+    }
+    else
+    {
+        char digits[48];
+        char* p = digits + sizeof(digits);
+        auto u = magnitude(value);
+        do
+        {
+            *--p = char('0' + u % 10);
+            u /= 10;
+        } while (u != 0);
+        if (value < 0)
+            *--p = '-';
+
+        const std::size_t size = digits + sizeof(digits) - p;
+        if (std::size_t(last - first) < size)
+            return nullptr;
+        std::memcpy(first, p, size);
+        return first + size;
+    }
+}
+
+inline bool is_space(char c) { return c == ' ' || c == '\n' || c == '\t' || c == '\r'; }
+
+} // namespace rational_detail
+
+//////////////////////////////////////////////////////////////////
+
+template <typename Int>
+std::from_chars_result from_chars(const char* first, const char* last, Rational<Int>& value)
+{
+    using namespace rational_detail;
+
+    Int num, den = 1;
+    std::from_chars_result result = parse_int(first, last, num);
+    if (result.ec != std::errc{})
+        return result;
+
+    if (result.ptr != last && *result.ptr == '/')
+    {
+        result = parse_int(result.ptr + 1, last, den);
+        if (result.ec == std::errc::invalid_argument)
+            return {first, result.ec};
+        if (result.ec != std::errc{})
+            return result;
+        if (den == 0)
+            return {first, std::errc::invalid_argument};
+
+        // Отрицательный знаменатель переносится в числитель сменой знака
+        // обоих — для min она непредставима.
+        using U = typename Traits<Int>::Unsigned;
+        const Int min = static_cast<Int>(U(1) << (sizeof(Int) * 8 - 1));
+        if (den < 0 && (num == min || den == min))
+            return {result.ptr, std::errc::result_out_of_range};
+    }
+
+    value = Rational<Int>(num, den);
+    return result;
+}
+
+// При нехватке места — {last, value_too_large}, как у std::to_chars.
+template <typename Int>
+std::to_chars_result to_chars(char* first, char* last, const Rational<Int>& value)
+{
+    using namespace rational_detail;
+
+    char* p = format_int(first, last, value.numerator());
+    if (p == nullptr || p == last)
+        return {last, std::errc::value_too_large};
+    *p++ = '/';
+    p = format_int(p, last, value.denominator());
+    if (p == nullptr)
+        return {last, std::errc::value_too_large};
+    return {p, std::errc{}};
+}
+
+//////////////////////////////////////////////////////////////////
+
+// Дроби через пробельные символы дописываются в out. ptr — конец
+// разобранного текста или начало первой ошибочной дроби.
+template <typename Int>
+std::from_chars_result parse_column(const char* first, const char* last, RationalColumn<Int>& out)
+{
+    using namespace rational_detail;
+
+    // Грубая оценка числа дробей, чтобы столбец не перевыделялся.
+    out.reserve(out.size() + std::size_t(last - first) / 8);
+
+    const char* p = first;
+    while (true)
+    {
+        while (p != last && is_space(*p))
+            ++p;
+        if (p == last)
+            return {p, std::errc{}};
+
+        Rational<Int> value;
+        const std::from_chars_result result = from_chars(p, last, value);
+        if (result.ec != std::errc{})
+            return {p, result.ec};
+        if (result.ptr != last && !is_space(*result.ptr))
+            return {p, std::errc::invalid_argument};
+
+        out.push_back(value);
+        p = result.ptr;
+    }
+}
+
+// Файл целиком: отображается в память и разбирается parse_column.
+// Ошибка открытия или чтения — соответствующий errno.
+template <typename Int>
+std::errc load_column(const char* path, RationalColumn<Int>& out)
+{
+    const int fd = ::open(path, O_RDONLY);
+    if (fd < 0)
+        return std::errc(errno);
+
+    struct stat info;
+    if (::fstat(fd, &info) != 0)
+    {
+        const int error = errno;
+        ::close(fd);
+        return std::errc(error);
+    }
+
+    const std::size_t size = std::size_t(info.st_size);
+    if (size == 0)
+    {
+        ::close(fd);
+        return std::errc{};
+    }
+
+    void* data = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    const int error = errno;
+    ::close(fd);
+    if (data == MAP_FAILED)
+        return std::errc(error);
+    ::madvise(data, size, MADV_SEQUENTIAL);
+
+    const char* text = static_cast<const char*>(data);
+    const std::errc result = parse_column(text, text + size, out).ec;
+    ::munmap(data, size);
+    return result;
+}
@@ -0,0 +1,71 @@
+#pragma once
+#include <array>
+#include <atomic>
+#include <cstddef>
+
+// Кольцевой буфер без блокировок для одного писателя и одного читателя.
+// Счётчики head и tail только растут, позиция — счётчик по модулю
+// Capacity (степень двойки). Каждый счётчик пишет только своя сторона
+// и держит его в отдельной строке кэша.
+
+template <typename T, std::size_t Capacity>
+class RingBuffer
+{
+    static_assert(Capacity > 0 && (Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+
+public:
+    static constexpr std::size_t capacity = Capacity;
+
+    // Вызывается только писателем; false, если буфер полон.
+    bool try_push(const T& value)
+    {
+        const std::size_t tail = m_tail.load(std::memory_order_relaxed);
+        if (tail - m_head_cache == Capacity)
+        {
+            m_head_cache = m_head.load(std::memory_order_acquire);
+            if (tail - m_head_cache == Capacity)
+                return false;
+        }
+
+        m_slots[tail & (Capacity - 1)] = value;
+        m_tail.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Вызывается только читателем; false, если буфер пуст.
+    bool try_pop(T& value)
+    {
+        const std::size_t head = m_head.load(std::memory_order_relaxed);
+        if (head == m_tail_cache)
+        {
+            m_tail_cache = m_tail.load(std::memory_order_acquire);
+            if (head == m_tail_cache)
+                return false;
+        }
+
+        value = m_slots[head & (Capacity - 1)];
+        m_head.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Приблизительно, если другая сторона работает одновременно.
+    std::size_t size() const
+    {
+        return m_tail.load(std::memory_order_acquire) - m_head.load(std::memory_order_acquire);
+    }
+
+    bool empty() const { return size() == 0; }
+
+private:
+    static constexpr std::size_t line = 64;
+
+    // Сторона писателя: свой счётчик и последнее увиденное значение чужого.
+    alignas(line) std::atomic<std::size_t> m_tail{0};
+    std::size_t m_head_cache = 0;
+
+    // Сторона читателя.
+    alignas(line) std::atomic<std::size_t> m_head{0};
+    std::size_t m_tail_cache = 0;
+
+    alignas(line) std::array<T, Capacity> m_slots{};
+};
@@ -0,0 +1,41 @@
+#pragma once
+#include "Instrument.hpp"
+
+#include <functional> // для std::less
+#include <utility>
+#include <vector>
+
+// Функция для разделения массива (pivot - последний элемент)
+template<typename T, typename Compare = std::less<T>>
+int partition(std::vector<T>& arr, int low, int high, Compare comp = Compare()) {
+    T pivot = arr[high]; // опорный элемент
+    int i = low - 1;
+
+    for (int j = low; j < high; ++j) {
+        // Меньше или равно; сравнения считаются там, где делаются.
+        INSTRUMENT_COUNT("sort.compare");
+        bool take = comp(arr[j], pivot);
+        if (!take) {
+            INSTRUMENT_COUNT("sort.compare");
+            take = arr[j] == pivot;
+        }
+        if (take) {
+            ++i;
+            std::swap(arr[i], arr[j]);
+        }
+    }
+    std::swap(arr[i + 1], arr[high]);
+
+    INSTRUMENT_HISTOGRAM("sort.partition", high - low + 1);
+    return i + 1;
+}
+
+// Рекурсивная быстрая сортировка
+template<typename T, typename Compare = std::less<T>>
+void quickSort(std::vector<T>& arr, int low, int high, Compare comp = Compare()) {
+    if (low < high) {
+        int pi = partition(arr, low, high, comp);
+        quickSort(arr, low, pi - 1, comp);
+        quickSort(arr, pi + 1, high, comp);
+    }
+}
@@ -0,0 +1,123 @@
+#pragma once
+#include "Instrument.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+// Пул постоянных потоков для параллельных циклов: run(count, f) вызывает
+// f(i) для всех i из [0, count) и возвращается, когда все вызовы завершены.
+// Индексы раздаются атомарным счётчиком, вызывающий поток тоже работает.
+// run() нельзя вызывать одновременно из нескольких потоков.
+
+class ThreadPool
+{
+public:
+    // threads — общее число потоков вместе с вызывающим.
+    explicit ThreadPool(std::size_t threads = std::max(1u, std::thread::hardware_concurrency()))
+    {
+        for (std::size_t i = 1; i < threads; ++i)
+            m_workers.emplace_back([this] { work(); });
+    }
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    ~ThreadPool()
+    {
+        {
+            std::lock_guard lock(m_mutex);
+            m_stop = true;
+        }
+        m_wake.notify_all();
+        for (auto& worker : m_workers)
+            worker.join();
+    }
+
+    std::size_t size() const { return m_workers.size() + 1; }
+
+    template <typename F>
+    void run(std::size_t count, F&& f)
+    {
+        if (count == 0)
+            return;
+
+        if (m_workers.empty() || count == 1)
+        {
+            for (std::size_t i = 0; i < count; ++i)
+                f(i);
+            return;
+        }
+
+        {
+            std::lock_guard lock(m_mutex);
+            using Fn = std::remove_reference_t<F>;
+            m_task = [](void* context, std::size_t i) { (*static_cast<Fn*>(context))(i); };
+            m_context = const_cast<void*>(static_cast<const void*>(std::addressof(f)));
+            m_count = count;
+            m_next.store(0, std::memory_order_relaxed);
+            m_busy = m_workers.size();
+            ++m_generation;
+        }
+        m_wake.notify_all();
+
+        drain();
+
+        std::unique_lock lock(m_mutex);
+        m_done.wait(lock, [this] { return m_busy == 0; });
+    }
+
+private:
+    void drain()
+    {
+        INSTRUMENT_SCOPE("ThreadPool::drain");
+        for (std::size_t i; (i = m_next.fetch_add(1, std::memory_order_relaxed)) < m_count;)
+        {
+            INSTRUMENT_COUNT("ThreadPool.task");
+            m_task(m_context, i);
+        }
+    }
+
+    void work()
+    {
+        std::uint64_t seen = 0;
+        std::unique_lock lock(m_mutex);
+        while (true)
+        {
+            m_wake.wait(lock, [&] { return m_stop || m_generation != seen; });
+            if (m_stop)
+                return;
+            seen = m_generation;
+
+            lock.unlock();
+            drain();
+            lock.lock();
+
+            if (--m_busy == 0)
+                m_done.notify_one();
+        }
+    }
+
+    std::vector<std::thread> m_workers;
+
+    std::mutex m_mutex;
+    std::condition_variable m_wake;
+    std::condition_variable m_done;
+
+    // Текущее задание; меняется только под m_mutex, пока рабочие спят.
+    void (*m_task)(void*, std::size_t) = nullptr;
+    void* m_context = nullptr;
+    std::size_t m_count = 0;
+    std::atomic<std::size_t> m_next{0};
+
+    std::size_t m_busy = 0;
+    std::uint64_t m_generation = 0;
+    bool m_stop = false;
+};
@@ -0,0 +1,54 @@
+#pragma once
+#include "Layout.hpp"
+
+#include <cstddef>
+#include <utility>
+
+//////////////////////////////////////////////////////////////////
+
+// Базовый шаблон для пустого кортежа
+template <typename... Ts> 
+class Tuple 
+{
+public:
+    // Конструктор по умолчанию
+    Tuple() = default;
+    
+    // Функция для получения размера кортежа
+    constexpr std::size_t size() const noexcept
+    {
+        return sizeof...(Ts);
+    }
+};
+
+//////////////////////////////////////////////////////////////////
+
+// Специализация для непустого кортежа. Элементы хранятся в Packed:
+// физически они упорядочены по убыванию выравнивания, поэтому
+// кортеж не тратит место на выравнивание между полями.
+template <typename T, typename... Ts> 
+class Tuple<T, Ts...>
+{
+private:
+    Packed<Deque<T, Ts...>> m_storage;
+
+public:
+    // Конструктор с perfect forwarding
+    Tuple(T&& x, Ts&&... ys)
+        : m_storage(std::forward<T>(x), std::forward<Ts>(ys)...)
+    {}
+
+    // Функция для получения элемента по индексу
+    template <std::size_t I> 
+    auto get() const
+    {
+        static_assert(I < sizeof...(Ts) + 1, "Index out of bounds");
+        return m_storage.template get<I>();
+    }
+
+    // Функция для получения размера кортежа
+    constexpr std::size_t size() const noexcept
+    {
+        return sizeof...(Ts) + 1;
+    }
+};
@@ -0,0 +1,93 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <utility>
+
+// Имя типа на этапе компиляции без RTTI: имя вырезается из сигнатуры
+// шаблонной функции (__PRETTY_FUNCTION__ у GCC и Clang, __FUNCSIG__
+// у MSVC) и копируется в статический массив ровно нужной длины, так что
+// в бинарнике остаётся только само имя. type_hash_v — FNV-1a от имени,
+// пригоден как ключ реестров, таблиц диспетчеризации и форматов
+// сериализации.
+//
+// Имена берутся из компилятора как есть: для шаблонов и типов
+// из пространств имён их написание (а значит и хэш) может различаться
+// между компиляторами; для простых классов совпадает.
+
+namespace type_name_detail
+{
+
+template <typename T>
+constexpr std::string_view signature()
+{
+#if defined(__clang__) || defined(__GNUC__)
+    return __PRETTY_FUNCTION__;
+#elif defined(_MSC_VER)
+    return __FUNCSIG__;
+#else
+#error "type_name: unsupported compiler"
+#endif
+}
+
+// Имя T внутри сигнатуры signature<T>():
+//   GCC:   "... signature() [with T = Name; std::string_view = ...]"
+//   Clang: "... signature() [T = Name]"
+//   MSVC:  "... signature<Name>(void)"
+template <typename T>
+constexpr std::string_view extract()
+{
+    std::string_view s = signature<T>();
+
+    // Конец имени ищется не по первой ']': она бывает в самом имени
+    // (int [3], int (*)[4]).
+#if defined(__clang__)
+    const std::size_t begin = s.find("T = ") + 4;
+    const std::size_t end = s.size() - 1;
+#elif defined(__GNUC__)
+    const std::size_t begin = s.find("T = ") + 4;
+    const std::size_t end = s.find(';', begin);
+#else
+    const std::size_t begin = s.find("signature<") + 10;
+    const std::size_t end = s.rfind(">(void)");
+#endif
+    std::string_view name = s.substr(begin, end - begin);
+
+    for (std::string_view prefix : {"struct ", "class ", "enum ", "union "})
+        if (name.starts_with(prefix))
+            name.remove_prefix(prefix.size());
+    return name;
+}
+
+template <typename T, std::size_t... Is>
+constexpr auto store(std::index_sequence<Is...>)
+{
+    return std::array<char, sizeof...(Is) + 1>{extract<T>()[Is]..., '\0'};
+}
+
+template <typename T>
+inline constexpr auto storage = store<T>(std::make_index_sequence<extract<T>().size()>{});
+
+} // namespace type_name_detail
+
+template <typename T>
+inline constexpr std::string_view type_name_v{type_name_detail::storage<T>.data(),
+                                              type_name_detail::storage<T>.size() - 1};
+
+template <typename T>
+constexpr std::string_view type_name() { return type_name_v<T>; }
+
+constexpr std::uint64_t fnv1a(std::string_view text)
+{
+    std::uint64_t hash = 14695981039346656037ull;
+    for (char c : text)
+    {
+        hash ^= static_cast<unsigned char>(c);
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+template <typename T>
+inline constexpr std::uint64_t type_hash_v = fnv1a(type_name_v<T>);
@@ -0,0 +1,324 @@
+#pragma once
+#include <cstddef>
+
+// Там, где компилятор предоставляет встроенные трейты (__is_same, __decay,
+// __remove_cvref и т.д.), используем их: они не порождают инстанцирований
+// шаблонов классов. Иначе — переносимые определения через частичные
+// специализации. TYPE_TRAITS_NO_BUILTINS принудительно выключает встроенные
+// трейты (для сравнения времени компиляции).
+
+#if defined(__has_builtin) && !defined(TYPE_TRAITS_NO_BUILTINS)
+#define TT_HAS_BUILTIN(x) __has_builtin(x)
+#else
+#define TT_HAS_BUILTIN(x) 0
+#endif
+
+template <typename T, T v>
+struct integral_constant
+{
+    static constexpr T value = v;
+};
+
+template <bool B>
+using bool_constant = integral_constant<bool, B>;
+
+using true_type  = bool_constant<true>;
+using false_type = bool_constant<false>;
+
+template <typename T>
+struct type_identity { using type = T; };
+
+//////////////////////////////////////////////////////////////////
+
+template <typename T>
+struct is_class : bool_constant<__is_class(T)> {};
+
+template <typename T>
+inline constexpr bool is_class_v = __is_class(T);
+
+//////////////////////////////////////////////////////////////////
+
+#if TT_HAS_BUILTIN(__is_same)
+
+template <typename T, typename U>
+inline constexpr bool is_same_v = __is_same(T, U);
+
+#else
+
+template <typename T, typename U>
+inline constexpr bool is_same_v = false;
+
+template <typename T>
+inline constexpr bool is_same_v<T, T> = true;
+
+#endif
+
+template <typename T, typename U>
+struct is_same : bool_constant<is_same_v<T, U>> {};
+
+//////////////////////////////////////////////////////////////////
+
+// conditional_t выбирает шаблон-псевдоним по значению B: инстанцируются
+// только две специализации селектора, а не по одной на каждую тройку <B, T, F>.
+template <bool B>
+struct conditional_selector
+{
+    template <typename T, typename F>
+    using type = T;
+};
+
+template <>
+struct conditional_selector<false>
+{
+    template <typename T, typename F>
+    using type = F;
+};
+
+template <bool B, typename T, typename F>
+using conditional_t = typename conditional_selector<B>::template type<T, F>;
+
+template <bool B, typename T, typename F>
+struct conditional { using type = conditional_t<B, T, F>; };
+
+//////////////////////////////////////////////////////////////////
+
+template <typename T>
+inline constexpr bool is_const_v = false;
+
+template <typename T>
+inline constexpr bool is_const_v<const T> = true;
+
+template <typename T>
+struct is_const : bool_constant<is_const_v<T>> {};
+
+template <typename T>
+inline constexpr bool is_reference_v = false;
+
+template <typename T>
+inline constexpr bool is_reference_v<T&> = true;
+
+template <typename T>
+inline constexpr bool is_reference_v<T&&> = true;
+
+template <typename T>
+struct is_reference : bool_constant<is_reference_v<T>> {};
+
+//////////////////////////////////////////////////////////////////
+
+template <typename T>
+struct remove_const { using type = T; };
+
+template <typename T>
+struct remove_const<const T> { using type = T; };
+
+template <typename T>
+using remove_const_t = typename remove_const<T>::type;
+
+template <typename T>
+struct remove_volatile { using type = T; };
+
+template <typename T>
+struct remove_volatile<volatile T> { using type = T; };
+
+template <typename T>
+using remove_volatile_t = typename remove_volatile<T>::type;
+
+#if TT_HAS_BUILTIN(__remove_cv)
+
+template <typename T>
+using remove_cv_t = __remove_cv(T);
+
+#else
+
+template <typename T>
+struct remove_cv_impl { using type = T; };
+
+template <typename T>
+struct remove_cv_impl<const T> { using type = T; };
+
+template <typename T>
+struct remove_cv_impl<volatile T> { using type = T; };
+
+template <typename T>
+struct remove_cv_impl<const volatile T> { using type = T; };
+
+template <typename T>
+using remove_cv_t = typename remove_cv_impl<T>::type;
+
+#endif
+
+template <typename T>
+struct remove_cv { using type = remove_cv_t<T>; };
+
+template <typename T>
+struct add_const { using type = const T; };
+
+template <typename T>
+using add_const_t = typename add_const<T>::type;
+
+//////////////////////////////////////////////////////////////////
+
+#if TT_HAS_BUILTIN(__remove_reference_t)
+
+template <typename T>
+using remove_reference_t = __remove_reference_t(T);
+
+#elif TT_HAS_BUILTIN(__remove_reference)
+
+template <typename T>
+using remove_reference_t = __remove_reference(T);
+
+#else
+
+template <typename T>
+struct remove_reference_impl { using type = T; };
+
+template <typename T>
+struct remove_reference_impl<T&> { using type = T; };
+
+template <typename T>
+struct remove_reference_impl<T&&> { using type = T; };
+
+template <typename T>
+using remove_reference_t = typename remove_reference_impl<T>::type;
+
+#endif
+
+template <typename T>
+struct remove_reference { using type = remove_reference_t<T>; };
+
+#if TT_HAS_BUILTIN(__remove_cvref)
+
+template <typename T>
+using remove_cvref_t = __remove_cvref(T);
+
+#else
+
+template <typename T>
+using remove_cvref_t = remove_cv_t<remove_reference_t<T>>;
+
+#endif
+
+template <typename T>
+struct remove_cvref { using type = remove_cvref_t<T>; };
+
+//////////////////////////////////////////////////////////////////
+
+#if TT_HAS_BUILTIN(__is_array)
+
+template <typename T>
+inline constexpr bool is_array_v = __is_array(T);
+
+#else
+
+template <typename T>
+inline constexpr bool is_array_v = false;
+
+template <typename T, std::size_t N>
+inline constexpr bool is_array_v<T[N]> = true;
+
+template <typename T>
+inline constexpr bool is_array_v<T[]> = true;
+
+#endif
+
+template <typename T>
+struct is_array : bool_constant<is_array_v<T>> {};
+
+#if TT_HAS_BUILTIN(__remove_extent)
+
+template <typename T>
+using remove_extent_t = __remove_extent(T);
+
+#else
+
+template <typename T>
+struct remove_extent_impl { using type = T; };
+
+template <typename T, std::size_t N>
+struct remove_extent_impl<T[N]> { using type = T; };
+
+template <typename T>
+struct remove_extent_impl<T[]> { using type = T; };
+
+template <typename T>
+using remove_extent_t = typename remove_extent_impl<T>::type;
+
+#endif
+
+template <typename T>
+struct remove_extent { using type = remove_extent_t<T>; };
+
+//////////////////////////////////////////////////////////////////
+
+// Без встроенного трейта: const не прилипает только к функциям
+// (включая cv-/ref-/noexcept-квалифицированные) и к ссылкам.
+#if TT_HAS_BUILTIN(__is_function)
+
+template <typename T>
+inline constexpr bool is_function_v = __is_function(T);
+
+#else
+
+template <typename T>
+inline constexpr bool is_function_v = !is_const_v<const T> && !is_reference_v<T>;
+
+#endif
+
+template <typename T>
+struct is_function : bool_constant<is_function_v<T>> {};
+
+//////////////////////////////////////////////////////////////////
+
+// Указатель на тип с cv-/ref-квалификаторами функции (void() const)
+// не образуется — такие типы возвращаются без изменений.
+#if TT_HAS_BUILTIN(__add_pointer)
+
+template <typename T>
+using add_pointer_t = __add_pointer(T);
+
+#else
+
+template <typename T>
+auto try_add_pointer(int) -> type_identity<remove_reference_t<T>*>;
+
+template <typename T>
+auto try_add_pointer(...) -> type_identity<T>;
+
+template <typename T>
+using add_pointer_t = typename decltype(try_add_pointer<T>(0))::type;
+
+#endif
+
+template <typename T>
+struct add_pointer { using type = add_pointer_t<T>; };
+
+//////////////////////////////////////////////////////////////////
+
+#if TT_HAS_BUILTIN(__decay)
+
+template <typename T>
+using decay_t = __decay(T);
+
+#else
+
+// Ветка выбирается частичной специализацией: вычисляется только
+// подходящий тип, а не все три, как во вложенных conditional_t.
+template <typename U, bool IsArray = is_array_v<U>, bool IsFunction = is_function_v<U>>
+struct decay_impl { using type = remove_cv_t<U>; };
+
+template <typename U, bool IsFunction>
+struct decay_impl<U, true, IsFunction> { using type = remove_extent_t<U>*; };
+
+template <typename U>
+struct decay_impl<U, false, true> { using type = add_pointer_t<U>; };
+
+template <typename T>
+using decay_t = typename decay_impl<remove_reference_t<T>>::type;
+
+#endif
+
+template <typename T>
+struct decay { using type = decay_t<T>; };
+
+#undef TT_HAS_BUILTIN
@@ -0,0 +1,272 @@
+#pragma once
+#include "Deque.hpp"
+
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+// Размеченное объединение над списком типов Deque<Ts...>: буфер размера
+// max_type, компактный индекс и посещение через таблицу переходов,
+// построенную на этапе компиляции (один косвенный вызов вместо цепочки if).
+// Альтернативы должны быть различными типами.
+
+// Тип индекса для N альтернатив: индексы 0..N-1 и npos — максимум типа.
+template <std::size_t N>
+using variant_index_t =
+    std::conditional_t<(N <= std::numeric_limits<std::uint8_t>::max()), std::uint8_t,
+    std::conditional_t<(N <= std::numeric_limits<std::uint16_t>::max()), std::uint16_t,
+                       std::uint32_t>>;
+
+template <typename... Fs>
+struct Overloaded : Fs...
+{
+    using Fs::operator()...;
+};
+
+template <typename... Fs>
+Overloaded(Fs...) -> Overloaded<Fs...>;
+
+//////////////////////////////////////////////////////////////////
+
+template <typename... Ts>
+class Variant
+{
+public:
+    using types = Deque<Ts...>;
+    using index_type = variant_index_t<sizeof...(Ts)>;
+
+    // Значение индекса после исключения в конструкторе альтернативы.
+    static constexpr index_type npos = std::numeric_limits<index_type>::max();
+
+    static_assert(sizeof...(Ts) > 0, "Variant must have at least one alternative");
+    static_assert(size_v<unique<types>> == sizeof...(Ts), "Variant alternatives must be distinct");
+
+    // -------------------------------------------------
+
+    Variant() requires std::is_default_constructible_v<front<types>>
+    {
+        emplace<front<types>>();
+    }
+
+    template <typename T>
+        requires has_v<std::remove_cvref_t<T>, types>
+    Variant(T&& value)
+    {
+        emplace<std::remove_cvref_t<T>>(std::forward<T>(value));
+    }
+
+    Variant(const Variant&) requires (std::is_trivially_copy_constructible_v<Ts> && ...) = default;
+
+    Variant(const Variant& other)
+    {
+        if (!other.valueless_by_exception())
+            other.visit([this](const auto& value) { construct(value); });
+    }
+
+    Variant(Variant&&) requires (std::is_trivially_move_constructible_v<Ts> && ...) = default;
+
+    Variant(Variant&& other) noexcept((std::is_nothrow_move_constructible_v<Ts> && ...))
+    {
+        if (!other.valueless_by_exception())
+            std::move(other).visit([this](auto&& value) { construct(std::move(value)); });
+    }
+
+    // -------------------------------------------------
+
+    ~Variant() requires (std::is_trivially_destructible_v<Ts> && ...) = default;
+
+    ~Variant()
+    {
+        reset();
+    }
+
+    // -------------------------------------------------
+
+    Variant& operator=(const Variant&)
+        requires (std::is_trivially_copy_assignable_v<Ts> && ...) &&
+                 (std::is_trivially_copy_constructible_v<Ts> && ...) &&
+                 (std::is_trivially_destructible_v<Ts> && ...) = default;
+
+    Variant& operator=(const Variant& other)
+    {
+        if (this != &other)
+            assign(other);
+        return *this;
+    }
+
+    Variant& operator=(Variant&&)
+        requires (std::is_trivially_move_assignable_v<Ts> && ...) &&
+                 (std::is_trivially_move_constructible_v<Ts> && ...) &&
+                 (std::is_trivially_destructible_v<Ts> && ...) = default;
+
+    Variant& operator=(Variant&& other)
+    {
+        if (this != &other)
+            assign(std::move(other));
+        return *this;
+    }
+
+    template <typename T>
+        requires has_v<std::remove_cvref_t<T>, types>
+    Variant& operator=(T&& value)
+    {
+        using U = std::remove_cvref_t<T>;
+        if (holds<U>())
+            get<U>() = std::forward<T>(value);
+        else
+            emplace<U>(std::forward<T>(value));
+        return *this;
+    }
+
+    // -------------------------------------------------
+
+    template <typename T, typename... Args>
+    T& emplace(Args&&... args)
+    {
+        static_assert(has_v<T, types>, "Type is not an alternative of this Variant");
+        reset();
+        T* value = ::new (static_cast<void*>(m_storage)) T(std::forward<Args>(args)...);
+        m_index = static_cast<index_type>(index_of_v<T, types>);
+        return *value;
+    }
+
+    // -------------------------------------------------
+
+    std::size_t index() const noexcept { return m_index; }
+
+    bool valueless_by_exception() const noexcept { return m_index == npos; }
+
+    template <typename T>
+    bool holds() const noexcept { return m_index == index_of_v<T, types>; }
+
+    template <typename T>
+    T& get() &
+    {
+        assert(holds<T>());
+        return alternative<index_of_v<T, types>>(*this);
+    }
+
+    template <typename T>
+    const T& get() const &
+    {
+        assert(holds<T>());
+        return alternative<index_of_v<T, types>>(*this);
+    }
+
+    template <typename T>
+    T&& get() &&
+    {
+        assert(holds<T>());
+        return alternative<index_of_v<T, types>>(std::move(*this));
+    }
+
+    template <typename T>
+    T* get_if() noexcept { return holds<T>() ? &get<T>() : nullptr; }
+
+    template <typename T>
+    const T* get_if() const noexcept { return holds<T>() ? &get<T>() : nullptr; }
+
+    // -------------------------------------------------
+
+    template <typename F>
+    decltype(auto) visit(F&& f) & { return dispatch(std::forward<F>(f), *this); }
+
+    template <typename F>
+    decltype(auto) visit(F&& f) const & { return dispatch(std::forward<F>(f), *this); }
+
+    template <typename F>
+    decltype(auto) visit(F&& f) && { return dispatch(std::forward<F>(f), std::move(*this)); }
+
+private:
+    // Ссылка на I-ю альтернативу с категорией значения и const от Self.
+    template <std::size_t I, typename Self>
+    static decltype(auto) alternative(Self&& self)
+    {
+        using T = nth<types, I>;
+        using Q = std::conditional_t<std::is_const_v<std::remove_reference_t<Self>>, const T, T>;
+
+        Q* value = std::launder(reinterpret_cast<Q*>(self.m_storage));
+        if constexpr (std::is_lvalue_reference_v<Self>)
+            return (*value);
+        else
+            return std::move(*value);
+    }
+
+    // Таблица из sizeof...(Ts) указателей на функции, по одной на
+    // альтернативу; вызов — одно индексирование и один косвенный переход.
+    template <typename F, typename Self>
+    static decltype(auto) dispatch(F&& f, Self&& self)
+    {
+        assert(!self.valueless_by_exception());
+
+        using R = std::invoke_result_t<F, decltype(alternative<0>(std::declval<Self>()))>;
+        using Thunk = R (*)(F&&, Self&&);
+
+        static constexpr auto table = []<std::size_t... Is>(std::index_sequence<Is...>)
+        {
+            return std::array<Thunk, sizeof...(Is)>{
+                +[](F&& f, Self&& self) -> R
+                {
+                    return std::invoke(std::forward<F>(f), alternative<Is>(std::forward<Self>(self)));
+                }...};
+        }(std::index_sequence_for<Ts...>{});
+
+        return table[self.m_index](std::forward<F>(f), std::forward<Self>(self));
+    }
+
+    template <typename T>
+    void construct(T&& value)
+    {
+        emplace<std::remove_cvref_t<T>>(std::forward<T>(value));
+    }
+
+    template <typename Other>
+    void assign(Other&& other)
+    {
+        if (other.valueless_by_exception())
+        {
+            reset();
+            return;
+        }
+
+        std::forward<Other>(other).visit([this](auto&& value)
+        {
+            using U = std::remove_cvref_t<decltype(value)>;
+            if (holds<U>())
+                get<U>() = std::forward<decltype(value)>(value);
+            else
+                emplace<U>(std::forward<decltype(value)>(value));
+        });
+    }
+
+    void reset() noexcept
+    {
+        if constexpr (!(std::is_trivially_destructible_v<Ts> && ...))
+        {
+            if (!valueless_by_exception())
+                visit([](auto& value)
+                {
+                    using U = std::remove_cvref_t<decltype(value)>;
+                    value.~U();
+                });
+        }
+        m_index = npos;
+    }
+
+    alignas(Ts...) std::byte m_storage[sizeof(max_type<types>)];
+    index_type m_index = npos;
+};
+
+//////////////////////////////////////////////////////////////////
+
+template <typename F, typename V>
+decltype(auto) visit(F&& f, V&& variant)
+{
+    return std::forward<V>(variant).visit(std::forward<F>(f));
+}
@@ -0,0 +1,27 @@
+// Модуль Variant: Variant.hpp вместе с Deque.hpp, на котором он построен.
+// Отдельного модуля Deque нет: Variant.hpp подключает Deque.hpp сам, и
+// его копия в модуле Variant конфликтовала бы с импортированной.
+//
+// Стандартная библиотека импортируется заголовочными модулями — их надо
+// собрать заранее (g++ -fmodules-ts -x c++-system-header algorithm ...).
+// Вместе с ними импортируются и их макросы-стражи, так что #include
+// стандартных заголовков внутри Variant.hpp и Deque.hpp ничего не делают.
+export module Variant;
+
+import <algorithm>;
+import <array>;
+import <cassert>;
+import <cstddef>;
+import <cstdint>;
+import <functional>;
+import <limits>;
+import <type_traits>;
+import <utility>;
+
+// Размещающий new из Variant::emplace GCC 12 ищет уже в точке
+// конкретизации, у импортёра, — поэтому <new> реэкспортируется.
+export import <new>;
+
+export {
+#include "Variant.hpp"
+}
@@ -0,0 +1,381 @@
+#pragma once
+#include "GameUnit.hpp"
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <limits>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+// Мир юнитов в духе ECS: компоненты Character хранятся плотными
+// массивами (здоровье, сила атаки, номер имени), группы — массивом
+// родителей. Юниты упорядочены обходом групп в глубину, поэтому любая
+// группа вместе с подгруппами занимает непрерывный диапазон [begin, end),
+// и атака группы — один линейный проход по этому диапазону.
+//
+// Идентификаторы юнитов и групп стабильны; физический порядок юнитов
+// пересчитывается в update(), который нужно вызвать после добавлений
+// перед работой с диапазонами групп.
+
+class World
+{
+public:
+    using UnitId  = std::uint32_t;
+    using GroupId = std::uint32_t;
+    using NameId  = std::uint32_t;
+
+    static constexpr GroupId no_group = std::numeric_limits<GroupId>::max();
+
+    struct Range
+    {
+        std::size_t begin = 0;
+        std::size_t end = 0;
+
+        std::size_t size() const { return end - begin; }
+    };
+
+    // -------------------------------------------------
+
+    GroupId add_group(GroupId parent = no_group)
+    {
+        assert(parent == no_group || parent < m_group_parent.size());
+
+        m_group_parent.push_back(parent);
+        m_dirty = true;
+        return static_cast<GroupId>(m_group_parent.size() - 1);
+    }
+
+    UnitId add_unit(GroupId group, const Character& character)
+    {
+        assert(group < m_group_parent.size());
+
+        const UnitId id = static_cast<UnitId>(m_health.size());
+        m_health.push_back(character.health);
+        m_attack.push_back(character.attackPower);
+        m_name.push_back(intern(character.name));
+        m_group.push_back(group);
+        m_slot.push_back(id);
+        m_id.push_back(id);
+        m_dirty = true;
+        return id;
+    }
+
+    void reserve(std::size_t units)
+    {
+        m_health.reserve(units);
+        m_attack.reserve(units);
+        m_name.reserve(units);
+        m_group.reserve(units);
+        m_slot.reserve(units);
+        m_id.reserve(units);
+    }
+
+    std::size_t unit_count()  const { return m_health.size(); }
+    std::size_t group_count() const { return m_group_parent.size(); }
+
+    // -------------------------------------------------
+
+    int health(UnitId id)       const { return m_health[m_slot[id]]; }
+    int attack_power(UnitId id) const { return m_attack[m_slot[id]]; }
+    std::string_view name(UnitId id) const { return m_names[m_name[m_slot[id]]]; }
+
+    void set_health(UnitId id, int health) { m_health[m_slot[id]] = health; }
+
+    Character character(UnitId id) const
+    {
+        return Character{std::string(name(id)), health(id), attack_power(id)};
+    }
+
+    GroupId parent(GroupId group) const { return m_group_parent[group]; }
+
+    // Физическая позиция юнита в столбцах; меняется при update().
+    std::size_t slot(UnitId id) const { check_layout(); return m_slot[id]; }
+
+    // -------------------------------------------------
+
+    // Диапазон слотов группы вместе со всеми подгруппами.
+    Range range(GroupId group) const
+    {
+        check_layout();
+        return {m_group_begin[group], m_group_end[group]};
+    }
+
+    // Собственные юниты группы — начало её диапазона.
+    Range own_range(GroupId group) const
+    {
+        check_layout();
+        return {m_group_begin[group], m_group_own_end[group]};
+    }
+
+    std::span<const GroupId> children(GroupId group) const
+    {
+        check_layout();
+        return std::span<const GroupId>(m_children).subspan(
+            m_child_begin[group], m_child_begin[group + 1] - m_child_begin[group]);
+    }
+
+    // Столбцы в физическом порядке, для систем, обрабатывающих диапазоны.
+    std::span<int>       healths()       { update(); return m_health; }
+    std::span<const int> healths() const { check_layout(); return m_health; }
+    std::span<const int> attack_powers() const { check_layout(); return m_attack; }
+    std::span<const NameId> name_ids() const { check_layout(); return m_name; }
+    std::span<const UnitId> unit_ids() const { check_layout(); return m_id; }
+
+    std::string_view name_of(NameId name) const { return m_names[name]; }
+
+    // -------------------------------------------------
+
+    // Суммарная сила атаки группы — один проход по непрерывному столбцу.
+    std::int64_t total_attack(GroupId group) const
+    {
+        const Range r = range(group);
+
+        std::int64_t total = 0;
+        for (std::size_t i = r.begin; i < r.end; ++i)
+            total += m_attack[i];
+        return total;
+    }
+
+    template <typename F>
+    void for_each_attack(GroupId group, F&& on_attack) const
+    {
+        const Range r = range(group);
+        for (std::size_t i = r.begin; i < r.end; ++i)
+            on_attack(m_id[i], m_attack[i]);
+    }
+
+    void attack(GroupId group, std::ostream& os = std::cout) const
+    {
+        const Range r = range(group);
+        for (std::size_t i = r.begin; i < r.end; ++i)
+            os << m_names[m_name[i]] << " attacks for " << m_attack[i] << " damage!\n";
+    }
+
+    // Сначала собственные юниты, затем подгруппы в порядке создания.
+    void info(GroupId group, int indent = 0, std::ostream& os = std::cout) const
+    {
+        os << std::string(indent, ' ') << "UnitGroup:\n";
+
+        const Range own = own_range(group);
+        for (std::size_t i = own.begin; i < own.end; ++i)
+            print_unit(i, indent + 2, os);
+
+        for (GroupId child : children(group))
+            info(child, indent + 2, os);
+    }
+
+    void info_unit(UnitId id, int indent = 0, std::ostream& os = std::cout) const
+    {
+        print_unit(m_slot[id], indent, os);
+    }
+
+    // Пересчёт физического порядка после добавления юнитов или групп.
+    void update()
+    {
+        if (m_dirty)
+            relayout();
+    }
+
+private:
+    void check_layout() const
+    {
+        assert(!m_dirty && "World::update() must be called after adding units or groups");
+    }
+
+    NameId intern(const std::string& name)
+    {
+        auto [it, inserted] = m_name_ids.try_emplace(name, static_cast<NameId>(m_names.size()));
+        if (inserted)
+            m_names.push_back(name);
+        return it->second;
+    }
+
+    void print_unit(std::size_t slot, int indent, std::ostream& os) const
+    {
+        os << std::string(indent, ' ')
+           << "Character: " << m_names[m_name[slot]]
+           << " [HP=" << m_health[slot]
+           << ", ATK=" << m_attack[slot] << "]\n";
+    }
+
+    void relayout()
+    {
+        const std::size_t groups = m_group_parent.size();
+        const std::size_t units = m_health.size();
+
+        // Дети каждой группы в порядке создания (CSR: m_child_begin + m_children).
+        m_child_begin.assign(groups + 1, 0);
+        for (GroupId g = 0; g < groups; ++g)
+            if (m_group_parent[g] != no_group)
+                ++m_child_begin[m_group_parent[g] + 1];
+        for (std::size_t g = 0; g < groups; ++g)
+            m_child_begin[g + 1] += m_child_begin[g];
+
+        m_children.resize(m_child_begin[groups]);
+        std::vector<std::size_t> cursor(m_child_begin.begin(), m_child_begin.end() - 1);
+        for (GroupId g = 0; g < groups; ++g)
+            if (m_group_parent[g] != no_group)
+                m_children[cursor[m_group_parent[g]]++] = g;
+
+        // Прямой обход групп в глубину.
+        std::vector<GroupId> preorder;
+        preorder.reserve(groups);
+        std::vector<GroupId> stack;
+        for (GroupId root = 0; root < groups; ++root)
+        {
+            if (m_group_parent[root] != no_group)
+                continue;
+
+            stack.push_back(root);
+            while (!stack.empty())
+            {
+                GroupId g = stack.back();
+                stack.pop_back();
+                preorder.push_back(g);
+                for (std::size_t c = m_child_begin[g + 1]; c-- > m_child_begin[g];)
+                    stack.push_back(m_children[c]);
+            }
+        }
+
+        // Собственные юниты групп — подряд в порядке обхода.
+        std::vector<std::size_t> own_count(groups, 0);
+        for (std::size_t slot = 0; slot < units; ++slot)
+            ++own_count[m_group[slot]];
+
+        m_group_begin.assign(groups, 0);
+        m_group_own_end.assign(groups, 0);
+        m_group_end.assign(groups, 0);
+
+        std::size_t offset = 0;
+        for (GroupId g : preorder)
+        {
+            m_group_begin[g] = offset;
+            offset += own_count[g];
+            m_group_own_end[g] = offset;
+            m_group_end[g] = offset;
+        }
+        for (std::size_t i = preorder.size(); i-- > 0;)
+        {
+            GroupId g = preorder[i];
+            GroupId p = m_group_parent[g];
+            if (p != no_group && m_group_end[g] > m_group_end[p])
+                m_group_end[p] = m_group_end[g];
+        }
+
+        // Устойчивая перестановка компонентов по новым слотам.
+        std::vector<std::size_t> next(m_group_begin);
+        std::vector<int> health(units), attack(units);
+        std::vector<NameId> name(units);
+        std::vector<GroupId> group(units);
+        std::vector<UnitId> id(units);
+        for (std::size_t slot = 0; slot < units; ++slot)
+        {
+            std::size_t to = next[m_group[slot]]++;
+            health[to] = m_health[slot];
+            attack[to] = m_attack[slot];
+            name[to]   = m_name[slot];
+            group[to]  = m_group[slot];
+            id[to]     = m_id[slot];
+            m_slot[m_id[slot]] = static_cast<UnitId>(to);
+        }
+
+        m_health = std::move(health);
+        m_attack = std::move(attack);
+        m_name   = std::move(name);
+        m_group  = std::move(group);
+        m_id     = std::move(id);
+        m_dirty  = false;
+    }
+
+    // Компоненты юнитов, индексируются слотом (физической позицией).
+    std::vector<int> m_health;
+    std::vector<int> m_attack;
+    std::vector<NameId> m_name;
+    std::vector<GroupId> m_group;
+    std::vector<UnitId> m_id;
+
+    // Слот юнита по его идентификатору.
+    std::vector<UnitId> m_slot;
+
+    std::vector<GroupId> m_group_parent;
+    std::vector<std::size_t> m_group_begin;
+    std::vector<std::size_t> m_group_own_end;
+    std::vector<std::size_t> m_group_end;
+    std::vector<std::size_t> m_child_begin;
+    std::vector<GroupId> m_children;
+
+    std::vector<std::string> m_names;
+    std::unordered_map<std::string, NameId> m_name_ids;
+
+    bool m_dirty = false;
+};
+
+////////////////////////////////////////////////////////////////////////////////////
+
+// Тонкие представления World через прежний интерфейс GameUnit.
+
+class UnitView : public GameUnit
+{
+public:
+    UnitView(World& world, World::UnitId id) : m_world(world), m_id(id) {}
+
+    void info(int indent = 0) const override { m_world.info_unit(m_id, indent); }
+
+    void attack() override
+    {
+        std::cout << m_world.name(m_id) << " attacks for " << m_world.attack_power(m_id) << " damage!\n";
+    }
+
+    std::size_t unitCount() const override { return 1; }
+
+    AttackEvent* collectAttacks(AttackEvent* out) const override
+    {
+        *out = {m_world.name(m_id), m_world.attack_power(m_id)};
+        return out + 1;
+    }
+
+private:
+    World& m_world;
+    World::UnitId m_id;
+};
+
+class GroupView : public GameUnit
+{
+public:
+    GroupView(World& world, World::GroupId group) : m_world(world), m_group(group) {}
+
+    void info(int indent = 0) const override
+    {
+        m_world.update();
+        m_world.info(m_group, indent);
+    }
+
+    void attack() override
+    {
+        m_world.update();
+        m_world.attack(m_group);
+    }
+
+    // Требуют актуальной раскладки (World::update()).
+    std::size_t unitCount() const override { return m_world.range(m_group).size(); }
+
+    AttackEvent* collectAttacks(AttackEvent* out) const override
+    {
+        const World& world = m_world;
+        world.for_each_attack(m_group, [&](World::UnitId id, int damage)
+        {
+            *out++ = {world.name(id), damage};
+        });
+        return out;
+    }
+
+private:
+    World& m_world;
+    World::GroupId m_group;
+};
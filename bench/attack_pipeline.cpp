@@ -0,0 +1,75 @@
+// Стоимость одной атаки: виртуальный AttackBehavior с печатью в поток,
+// тот же интерфейс поверх конвейера и конвейер политик напрямую.
+// Сборка из корня репозитория:
+//   g++ -std=c++20 -O2 -I. bench/attack_pipeline.cpp -o build/attack_pipeline
+//   build/attack_pipeline [число атак, по умолчанию 10^7]
+
+#include "AttackBehavior.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <memory>
+
+template <typename F>
+static double time_ns(F&& f, std::size_t count)
+{
+    auto start = std::chrono::steady_clock::now();
+    f();
+    auto stop = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(stop - start).count() / count;
+}
+
+int main(int argc, char** argv)
+{
+    std::size_t n = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 10000000;
+
+    // Печать — в /dev/null, чтобы мерить форматирование и вызовы, а не терминал.
+    std::ofstream devnull("/dev/null");
+    const std::size_t printed = n / 10;
+
+    std::unique_ptr<AttackBehavior> stream = std::make_unique<PipelineAttack<SwordPipeline>>(devnull);
+    double virtual_stream = time_ns([&]
+    {
+        for (std::size_t i = 0; i < printed; ++i)
+            stream->performAttack();
+    }, printed);
+
+    std::unique_ptr<AttackBehavior> null = std::make_unique<PipelineAttack<SwordPipeline, NullSink>>();
+    double virtual_null = time_ns([&]
+    {
+        for (std::size_t i = 0; i < n; ++i)
+            null->performAttack();
+    }, n);
+
+    static RingBuffer<AttackRecord, 4096> ring;
+    RingSink<4096> sink(ring);
+    std::size_t drained = 0;
+    double inline_ring = time_ns([&]
+    {
+        AttackRecord record;
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            SwordPipeline::perform(sink);
+            if (ring.size() > 4096 - 3)
+                while (ring.try_pop(record))
+                    ++drained;
+        }
+    }, n);
+
+    NullSink nothing;
+    double inline_null = time_ns([&]
+    {
+        for (std::size_t i = 0; i < n; ++i)
+            SwordPipeline::perform(nothing);
+    }, n);
+
+    std::printf("attacks: %zu (%zu printed)\n", n, printed);
+    std::printf("virtual, stream sink:  %6.2f ns/attack\n", virtual_stream);
+    std::printf("virtual, null sink:    %6.2f ns/attack\n", virtual_null);
+    std::printf("pipeline, ring sink:   %6.2f ns/attack (dropped %zu, drained %zu)\n",
+                inline_ring, sink.dropped(), drained);
+    std::printf("pipeline, null sink:   %6.2f ns/attack\n", inline_null);
+}
@@ -0,0 +1,137 @@
+// Вызов и смена поведения: AnyBehavior (встроенный буфер, указатель
+// на функцию в объекте) против std::function и виртуального вызова
+// через std::unique_ptr.
+// Сборка из корня репозитория:
+//   g++ -std=c++20 -O2 -I. bench/behavior_dispatch.cpp -o build/behavior_dispatch
+//   build/behavior_dispatch [число юнитов, по умолчанию 10^6]
+
+#include "AnyBehavior.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <memory>
+#include <random>
+#include <vector>
+
+template <typename F>
+static double time_ns(F&& f, std::size_t count)
+{
+    auto start = std::chrono::steady_clock::now();
+    f();
+    auto stop = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(stop - start).count() / count;
+}
+
+static std::int64_t total = 0;
+
+struct Sword { int power; void attack() const { total += power * 3; } };
+struct Magic { int power; void attack() const { total += power * power; } };
+struct Bow   { int power; void attack() const { total += power + 7; } };
+
+struct Base
+{
+    virtual ~Base() = default;
+    virtual void attack() const = 0;
+};
+
+template <typename Behavior>
+struct Virtual : Base
+{
+    explicit Virtual(Behavior b) : behavior(b) {}
+    void attack() const override { behavior.attack(); }
+    Behavior behavior;
+};
+
+// Устанавливает в slot поведение kind с силой power.
+template <typename Slot, typename Make>
+static void equip(Slot& slot, int kind, int power, Make make)
+{
+    switch (kind)
+    {
+    case 0:  slot = make(Sword{power}); break;
+    case 1:  slot = make(Magic{power}); break;
+    default: slot = make(Bow{power}); break;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    std::size_t n = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 1000000;
+    const int rounds = 20;
+
+    std::mt19937 rng(42);
+    std::uniform_int_distribution<int> kind(0, 2), power(1, 100);
+    std::vector<int> kinds(n), powers(n);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        kinds[i] = kind(rng);
+        powers[i] = power(rng);
+    }
+
+    auto as_any = [](auto b) { return AnyBehavior<>(b); };
+    auto as_function = [](auto b) { return std::function<void()>([b] { b.attack(); }); };
+    auto as_virtual = [](auto b) { return std::unique_ptr<Base>(std::make_unique<Virtual<decltype(b)>>(b)); };
+
+    std::vector<AnyBehavior<>> any(n);
+    std::vector<std::function<void()>> functions(n);
+    std::vector<std::unique_ptr<Base>> pointers(n);
+
+    // Смена поведения у всех юнитов (оружие меняется по кругу).
+    double equip_any = time_ns([&]
+    {
+        for (std::size_t i = 0; i < n; ++i)
+            equip(any[i], kinds[i], powers[i], as_any);
+    }, n);
+    double equip_function = time_ns([&]
+    {
+        for (std::size_t i = 0; i < n; ++i)
+            equip(functions[i], kinds[i], powers[i], as_function);
+    }, n);
+    double equip_virtual = time_ns([&]
+    {
+        for (std::size_t i = 0; i < n; ++i)
+            equip(pointers[i], kinds[i], powers[i], as_virtual);
+    }, n);
+
+    std::int64_t results[3];
+
+    total = 0;
+    double call_any = time_ns([&]
+    {
+        for (int r = 0; r < rounds; ++r)
+            for (const auto& b : any)
+                b.attack();
+    }, n * rounds);
+    results[0] = total;
+
+    total = 0;
+    double call_function = time_ns([&]
+    {
+        for (int r = 0; r < rounds; ++r)
+            for (const auto& f : functions)
+                f();
+    }, n * rounds);
+    results[1] = total;
+
+    total = 0;
+    double call_virtual = time_ns([&]
+    {
+        for (int r = 0; r < rounds; ++r)
+            for (const auto& p : pointers)
+                p->attack();
+    }, n * rounds);
+    results[2] = total;
+
+    const bool same = results[0] == results[1] && results[1] == results[2];
+    std::printf("units: %zu, sizeof: AnyBehavior %zu, std::function %zu\n",
+                n, sizeof(AnyBehavior<>), sizeof(std::function<void()>));
+    std::printf("                  equip ns   attack ns\n");
+    std::printf("AnyBehavior       %8.2f   %9.2f\n", equip_any, call_any);
+    std::printf("std::function     %8.2f   %9.2f\n", equip_function, call_function);
+    std::printf("unique_ptr+virt   %8.2f   %9.2f\n", equip_virtual, call_virtual);
+    std::printf("%s\n", same ? "results match" : "RESULTS DIFFER");
+}
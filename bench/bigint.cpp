@@ -0,0 +1,122 @@
+// BigInt: время умножения по длинам (выше порога Карацубы удвоение
+// длины должно стоить ~3×, а не 4×), НОД Лемера против Евклида на
+// делении, и BigRational против Rational<__int128> — на малых значениях
+// (встроенное хранение, без кучи) и на гармоническом ряде.
+// Сборка из корня репозитория:
+//   g++ -std=c++20 -O2 -I. bench/bigint.cpp -o build/bigint
+//   build/bigint
+
+#include "BigRational.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+template <typename F>
+static double time_ns(F&& f, int repeats)
+{
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < repeats; ++i)
+        f();
+    auto stop = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(stop - start).count() / repeats;
+}
+
+static volatile std::size_t sink;
+
+static BigInt random_big(std::mt19937_64& rng, std::size_t limbs)
+{
+    const BigInt base = BigInt(1) + BigInt(INT64_MAX);
+    BigInt result = 1;
+    for (std::size_t i = 0; i < limbs; ++i)
+        result = result * base + BigInt(std::int64_t(rng() >> 1));
+    return result;
+}
+
+static BigInt euclid(BigInt a, BigInt b)
+{
+    while (!b.is_zero())
+    {
+        BigInt r = a % b;
+        a = std::move(b);
+        b = std::move(r);
+    }
+    return a;
+}
+
+int main()
+{
+    std::mt19937_64 rng(42);
+
+    std::printf("mul, limbs (threshold %zu):\n", BigInt::karatsuba_threshold);
+    double previous = 0;
+    for (std::size_t limbs = 8; limbs <= 2048; limbs *= 2)
+    {
+        const BigInt a = random_big(rng, limbs), b = random_big(rng, limbs);
+        const int repeats = int(std::max<std::size_t>(1, (1 << 22) / (limbs * limbs)));
+        const double ns = time_ns([&] { sink = (a * b).limbs(); }, repeats);
+        std::printf("  %5zu  %12.0f ns", limbs, ns);
+        if (previous > 0)
+            std::printf("   x%.2f", ns / previous);
+        std::printf("\n");
+        previous = ns;
+    }
+
+    std::printf("gcd, limbs:       lehmer       euclid\n");
+    for (std::size_t limbs : {4, 16, 64, 256})
+    {
+        const BigInt c = random_big(rng, limbs / 4);
+        const BigInt a = random_big(rng, limbs) * c, b = random_big(rng, limbs) * c;
+        const int repeats = int(std::max<std::size_t>(1, 4096 / limbs));
+        const double lehmer = time_ns([&] { sink = gcd(a, b).limbs(); }, repeats);
+        const double plain = time_ns([&] { sink = euclid(a, b).limbs(); }, repeats);
+        std::printf("  %5zu  %12.0f ns %12.0f ns\n", limbs, lehmer, plain);
+    }
+
+    // Малые дроби: у обоих типов нет выделений памяти.
+    std::uniform_int_distribution<int> num(-30000, 30000), den(1, 30000);
+    const std::size_t n = 200000;
+    std::vector<int> nums(2 * n), dens(2 * n);
+    for (std::size_t i = 0; i < 2 * n; ++i)
+    {
+        nums[i] = num(rng);
+        dens[i] = den(rng);
+    }
+
+    auto small = [&]<typename R>(const char* name)
+    {
+        std::vector<R> a, b, out(n);
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            a.emplace_back(nums[2 * i], dens[2 * i]);
+            b.emplace_back(nums[2 * i + 1], dens[2 * i + 1]);
+        }
+        const double add = time_ns([&] { for (std::size_t i = 0; i < n; ++i) out[i] = a[i] + b[i]; }, 3) / n;
+        const double cmp = time_ns([&]
+        {
+            std::size_t less = 0;
+            for (std::size_t i = 0; i < n; ++i)
+                less += a[i] < b[i];
+            sink = less;
+        }, 3) / n;
+        std::printf("%-20s add %6.1f   cmp %6.1f  ns/op\n", name, add, cmp);
+    };
+    small.operator()<Rational<__int128>>("Rational<__int128>");
+    small.operator()<BigRational>("BigRational");
+
+    // Сумма 1/k: у __int128 знаменатель переполняется уже на k = 100.
+    for (int terms : {50, 500, 2000})
+    {
+        BigRational h;
+        const double ns = time_ns([&]
+        {
+            h = BigRational();
+            for (int k = 1; k <= terms; ++k)
+                h += BigRational(1, k);
+        }, 1);
+        std::printf("H(%d): %8.2f ms, denominator %zu limbs\n", terms, ns / 1e6, h.denominator().limbs());
+    }
+}
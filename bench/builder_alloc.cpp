@@ -0,0 +1,80 @@
+// Число выделений памяти и время на одну запись Person:
+// get() (копия) против build() && и пакетного Builder::build_into.
+// Сборка из корня репозитория:
+//   g++ -std=c++20 -O2 -I. bench/builder_alloc.cpp -o build/builder_alloc
+
+#include "Person.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <string>
+#include <vector>
+
+static std::size_t g_allocations = 0;
+
+void* operator new(std::size_t size)
+{
+    ++g_allocations;
+    if (void* p = std::malloc(size ? size : 1))
+        return p;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+
+// Имена длиннее буфера SSO, чтобы каждая копия строки выделяла память.
+static std::vector<std::string> make_names(std::size_t n)
+{
+    std::vector<std::string> names;
+    names.reserve(n);
+    for (std::size_t i = 0; i < n; ++i)
+        names.push_back("person-with-a-long-name-" + std::to_string(i));
+    return names;
+}
+
+template <typename F>
+static void measure(const char* label, std::size_t n, F&& f)
+{
+    auto names = make_names(n);
+    std::vector<Person> out;
+    out.reserve(n);
+
+    std::size_t before = g_allocations;
+    auto start = std::chrono::steady_clock::now();
+    f(names, out);
+    auto stop = std::chrono::steady_clock::now();
+    std::size_t allocations = g_allocations - before;
+
+    double ns = std::chrono::duration<double, std::nano>(stop - start).count();
+    std::printf("%-24s %6.2f allocs/object %8.1f ns/object\n",
+                label, double(allocations) / n, ns / n);
+}
+
+int main(int argc, char** argv)
+{
+    std::size_t n = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 1000000;
+
+    std::vector<int> ages(n, 25), grades(n, 10);
+
+    measure("get() copy", n, [&](std::vector<std::string>& names, std::vector<Person>& out)
+    {
+        Builder builder;
+        for (std::size_t i = 0; i < n; ++i)
+            out.push_back(builder.name(names[i]).age(ages[i]).grade(grades[i]).get());
+    });
+
+    measure("build() && move", n, [&](std::vector<std::string>& names, std::vector<Person>& out)
+    {
+        for (std::size_t i = 0; i < n; ++i)
+            out.push_back(Builder().name(std::move(names[i])).age(ages[i]).grade(grades[i]).build());
+    });
+
+    measure("build_into() bulk", n, [&](std::vector<std::string>& names, std::vector<Person>& out)
+    {
+        Builder::build_into(out, names, ages, grades);
+    });
+}
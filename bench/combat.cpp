@@ -0,0 +1,85 @@
+// Пакетный бой: удар за ударом с ветвлениями против CombatEngine.
+// Сборка из корня репозитория:
+//   g++ -std=c++20 -O2 -I. bench/combat.cpp -o build/combat
+//   build/combat [юнитов, по умолчанию 10^6] [ударов в пакете, по умолчанию 10^7]
+
+#include "Combat.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+// Среднее время f() по repeats запускам; reset() перед каждым запуском не учитывается.
+template <typename R, typename F>
+static double time_ms(R&& reset, F&& f, int repeats)
+{
+    std::chrono::steady_clock::duration total{};
+    for (int i = 0; i < repeats; ++i)
+    {
+        reset();
+        auto start = std::chrono::steady_clock::now();
+        f();
+        total += std::chrono::steady_clock::now() - start;
+    }
+    return std::chrono::duration<double, std::milli>(total).count() / repeats;
+}
+
+int main(int argc, char** argv)
+{
+    std::size_t units = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 1000000;
+    std::size_t count = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 10000000;
+
+    std::mt19937 rng(42);
+    std::uniform_int_distribution<int> hp(100, 1000), atk(1, 40);
+    std::uniform_int_distribution<CombatEngine::Slot> slot(0, CombatEngine::Slot(units - 1));
+
+    std::vector<int> initial(units), attack(units);
+    for (std::size_t i = 0; i < units; ++i)
+    {
+        initial[i] = hp(rng);
+        attack[i] = atk(rng);
+    }
+
+    std::vector<CombatEngine::Hit> hits(count);
+    for (auto& hit : hits)
+        hit = {slot(rng), slot(rng)};
+
+    std::vector<int> health;
+    std::vector<CombatEngine::Slot> dead;
+    std::size_t naive_dead = 0, engine_dead = 0;
+
+    auto reset = [&] { health = initial; };
+
+    double naive = time_ms(reset, [&]
+    {
+        dead.clear();
+        for (const auto& hit : hits)
+        {
+            int& h = health[hit.target];
+            if (h > 0)
+            {
+                h -= attack[hit.attacker];
+                if (h <= 0)
+                {
+                    h = 0;
+                    dead.push_back(hit.target);
+                }
+            }
+        }
+        naive_dead = dead.size();
+    }, 5);
+
+    CombatEngine engine;
+    double batched = time_ms(reset, [&]
+    {
+        engine_dead = engine.resolve(health, attack, hits).size();
+    }, 5);
+
+    std::printf("units: %zu, hits: %zu, dead: %zu / %zu\n", units, count, naive_dead, engine_dead);
+    std::printf("per hit:  %.1f ms, %.1f M hits/s\n", naive, count / naive / 1e3);
+    std::printf("batched:  %.1f ms, %.1f M hits/s\n", batched, count / batched / 1e3);
+}
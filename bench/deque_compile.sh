@@ -0,0 +1,42 @@
+#!/usr/bin/env bash
+set -e
+
+# Время компиляции алгоритмов Deque.hpp на списках из 10..2000 типов.
+# Запуск из корня репозитория: bash bench/deque_compile.sh [размеры...]
+
+SIZES=${*:-10 50 100 500 1000 2000}
+CXX=${CXX:-clang++}
+OUT=${OUT:-build/deque_compile}
+mkdir -p "$OUT"
+
+for N in $SIZES; do
+    SRC="$OUT/deque_$N.cpp"
+    {
+        echo '#include "Deque.hpp"'
+        echo 'template <int I> struct Tag { char data[I % 7 + 1]; };'
+        echo 'template <typename T> using Ptr = T*;'
+        echo 'template <typename T> struct Odd { static constexpr bool value = sizeof(T) % 2 == 1; };'
+        printf 'using D = Deque<'
+        i=0
+        while [ $i -lt "$N" ]; do
+            [ $i -gt 0 ] && printf ', '
+            printf 'Tag<%d>' $((i % (N / 2 + 1)))
+            i=$((i + 1))
+        done
+        echo '>;'
+        echo "static_assert(size_v<push_back<int, D>> == $N + 1);"
+        echo "static_assert(size_v<pop_back<D>> == $N - 1);"
+        echo "static_assert(sizeof(back<D>) > 0 && sizeof(nth<D, $N / 2>) > 0);"
+        echo "static_assert(sizeof(max_type<D>) <= 7);"
+        echo "static_assert(has_v<Tag<0>, D> && !has_v<int, D>);"
+        echo "static_assert(index_of_v<back<D>, D> < $N);"
+        echo "static_assert(size_v<transform<Ptr, D>> == $N);"
+        echo "static_assert(size_v<filter<Odd, D>> <= $N);"
+        echo "static_assert(size_v<unique<D>> == $N / 2 + 1);"
+        echo "static_assert(size_v<sort_by_size<D>> == $N);"
+    } > "$SRC"
+
+    echo "=== $N types ==="
+    time $CXX -std=c++20 -I. -fsyntax-only "$SRC"
+    echo
+done
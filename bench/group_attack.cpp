@@ -0,0 +1,73 @@
+// Атака большого дерева UnitGroup: последовательный collectAttacks()
+// против AttackPlan на пуле из 1, 2, 4, ... потоков.
+// Сборка из корня репозитория:
+//   g++ -std=c++20 -O2 -pthread -I. bench/group_attack.cpp -o build/group_attack
+//   build/group_attack [наибольшее число юнитов, по умолчанию 10^7]
+
+#include "GameUnit.hpp"
+#include "ParallelAttack.hpp"
+#include "ThreadPool.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+template <typename F>
+static double time_ms(F&& f, int repeats)
+{
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < repeats; ++i)
+        f();
+    auto stop = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(stop - start).count() / repeats;
+}
+
+// Армия из n юнитов: отряды по 64 юнита, по 16 отрядов в роте и т. д.
+static GameUnitPtr make_army(std::size_t n, std::size_t& next)
+{
+    auto group = std::make_shared<UnitGroup>();
+    if (n <= 64)
+    {
+        for (std::size_t i = 0; i < n; ++i, ++next)
+            group->addUnit(std::make_shared<SingleUnit>(
+                CharacterBuilder().setName("Unit" + std::to_string(next % 100)).setAttack(int(next % 50)).build()));
+        return group;
+    }
+
+    const std::size_t part = (n + 15) / 16;
+    for (std::size_t done = 0; done < n; done += part)
+        group->addUnit(make_army(std::min(part, n - done), next));
+    return group;
+}
+
+int main(int argc, char** argv)
+{
+    std::size_t max_units = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 10000000;
+    std::size_t max_threads = std::max(1u, std::thread::hardware_concurrency());
+
+    for (std::size_t n = 100000; n <= max_units; n *= 10)
+    {
+        std::size_t next = 0;
+        GameUnitPtr army = make_army(n, next);
+        std::vector<AttackEvent> events(n);
+
+        const int repeats = n >= 10000000 ? 3 : 10;
+        double sequential = time_ms([&] { army->collectAttacks(events.data()); }, repeats);
+        std::printf("units: %zu, sequential %.2f ms\n", n, sequential);
+
+        AttackPlan plan(*army);
+        for (std::size_t threads = 1; threads <= max_threads; threads *= 2)
+        {
+            ThreadPool pool(threads);
+            double parallel = time_ms([&] { plan.run(pool, events); }, repeats);
+            std::printf("  %2zu threads, %zu items: %.2f ms (x%.2f)\n",
+                        threads, plan.items(), parallel, sequential / parallel);
+        }
+    }
+}
@@ -0,0 +1,58 @@
+// Цена инструментирования на одну операцию: пустой цикл против
+// INSTRUMENT_COUNT, INSTRUMENT_HISTOGRAM и INSTRUMENT_SCOPE — без записи
+// трассы и с ней; в конце — отчёт и размер трассы Chrome.
+// Без INSTRUMENT_ENABLED макросы пусты, и цена — ноль.
+// Сборка из корня репозитория:
+//   g++ -std=c++20 -O2 -I. bench/instrument.cpp -o build/instrument
+//   build/instrument [число операций, по умолчанию 10^7]
+
+#define INSTRUMENT_ENABLED 1
+
+#include "Instrument.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+
+template <typename F>
+static double time_ns(std::size_t n, F&& f)
+{
+    auto start = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < n; ++i)
+        f(i);
+    auto stop = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(stop - start).count() / double(n);
+}
+
+int main(int argc, char** argv)
+{
+    std::size_t n = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 10000000;
+
+    volatile std::size_t sink = 0;
+    const double empty = time_ns(n, [&](std::size_t i) { sink = i; });
+    const double count = time_ns(n, [&](std::size_t i) { sink = i; INSTRUMENT_COUNT("bench.count"); });
+    const double histogram = time_ns(n, [&](std::size_t i) { sink = i; INSTRUMENT_HISTOGRAM("bench.histogram", i); });
+    const double scope = time_ns(n, [&](std::size_t i) { INSTRUMENT_SCOPE("bench.scope"); sink = i; });
+
+    // Буфер трассы — trace_capacity событий, дальше они отбрасываются.
+    const std::size_t traced_n = instrument::trace_capacity;
+    instrument::start_trace();
+    const double traced = time_ns(traced_n, [&](std::size_t i) { INSTRUMENT_SCOPE("bench.traced"); sink = i; });
+    instrument::stop_trace();
+
+    std::printf("operations: %zu, ns per operation\n", n);
+    std::printf("empty loop           %6.2f\n", empty);
+    std::printf("INSTRUMENT_COUNT     %6.2f\n", count);
+    std::printf("INSTRUMENT_HISTOGRAM %6.2f\n", histogram);
+    std::printf("INSTRUMENT_SCOPE     %6.2f\n", scope);
+    std::printf("  with trace         %6.2f  (%zu events)\n", traced, traced_n);
+
+    std::ostringstream trace;
+    instrument::write_chrome_trace(trace);
+    std::printf("chrome trace: %.1f MB\n\n", trace.str().size() / 1e6);
+    instrument::write_report(std::cout);
+}
@@ -0,0 +1,89 @@
+// Запросы по возрасту и классу: линейный проход по std::vector<Person>
+// против индексов PersonTable.
+// Сборка из корня репозитория:
+//   g++ -std=c++20 -O2 -I. bench/person_table.cpp -o build/person_table
+//   build/person_table [число строк, по умолчанию 10^7]
+
+#include "Person.hpp"
+#include "PersonTable.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+template <typename F>
+static double time_ms(F&& f, int repeats)
+{
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < repeats; ++i)
+        f();
+    auto stop = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(stop - start).count() / repeats;
+}
+
+int main(int argc, char** argv)
+{
+    std::size_t n = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 10000000;
+
+    std::mt19937 rng(42);
+    std::uniform_int_distribution<int> age(6, 80), grade(1, 11);
+
+    std::vector<std::string> names(n);
+    std::vector<int> ages(n), grades(n);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        std::string name = "p";
+        name += std::to_string(i);
+        names[i] = std::move(name);
+        ages[i] = age(rng);
+        grades[i] = grade(rng);
+    }
+
+    PersonTable table;
+    double insert_ms = time_ms([&] { table.insert(names, ages, grades); }, 1);
+    double index_ms = time_ms([&] { table.build_indexes(); }, 1);
+
+    std::vector<Person> people;
+    Builder::build_into(people, names, ages, grades);
+
+    std::printf("rows: %zu, bulk insert %.1f ms, index build %.1f ms\n", n, insert_ms, index_ms);
+
+    volatile std::size_t sink = 0;
+
+    double scan_eq = time_ms([&]
+    {
+        std::size_t count = 0;
+        for (const auto& p : people)
+            count += p.age() == 30;
+        sink = count;
+    }, 5);
+    double index_eq = time_ms([&] { sink = table.by_age(30, 30).size(); }, 1000);
+
+    double scan_range = time_ms([&]
+    {
+        std::size_t count = 0;
+        for (const auto& p : people)
+            count += p.grade() >= 9 && p.grade() <= 10;
+        sink = count;
+    }, 5);
+    double index_range = time_ms([&] { sink = table.by_grade(9, 10).size(); }, 1000);
+
+    double scan_both = time_ms([&]
+    {
+        std::size_t count = 0;
+        for (const auto& p : people)
+            count += p.age() >= 17 && p.age() <= 18 && p.grade() == 11;
+        sink = count;
+    }, 5);
+    double index_both = time_ms([&] { sink = table.query(17, 18, 11, 11).size(); }, 20);
+
+    std::printf("%-28s %12s %12s\n", "query", "scan, ms", "index, ms");
+    std::printf("%-28s %12.3f %12.4f\n", "age == 30", scan_eq, index_eq);
+    std::printf("%-28s %12.3f %12.4f\n", "grade in [9, 10]", scan_range, index_range);
+    std::printf("%-28s %12.3f %12.4f\n", "age in [17, 18], grade 11", scan_both, index_both);
+}
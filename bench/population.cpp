@@ -0,0 +1,120 @@
+// Обход смешанной армии: std::vector<std::unique_ptr<Base>> с виртуальным
+// attack(), std::vector<Variant<...>> с visit и Population с корзинами
+// по поведениям.
+// Сборка из корня репозитория:
+//   g++ -std=c++20 -O2 -I. bench/population.cpp -o build/population
+//   build/population [число сущностей, по умолчанию 10^7]
+
+#include "Population.hpp"
+#include "Variant.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <random>
+#include <vector>
+
+template <typename F>
+static double time_ms(F&& f, int repeats)
+{
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < repeats; ++i)
+        f();
+    auto stop = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(stop - start).count() / repeats;
+}
+
+struct Sword { int power; int attack() const { return power * 3; } };
+struct Magic { int power; int attack() const { return power * power; } };
+struct Bow   { int power; int attack() const { return power + 7; } };
+
+template <typename Behavior>
+struct Unit : Behavior {};
+
+struct Base
+{
+    virtual ~Base() = default;
+    virtual int attack() const = 0;
+};
+
+template <typename Behavior>
+struct Virtual : Base
+{
+    explicit Virtual(Behavior b) : behavior(b) {}
+    int attack() const override { return behavior.attack(); }
+    Behavior behavior;
+};
+
+int main(int argc, char** argv)
+{
+    std::size_t n = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 10000000;
+
+    std::mt19937 rng(42);
+    std::uniform_int_distribution<int> kind(0, 2), power(1, 100);
+
+    std::vector<std::unique_ptr<Base>> pointers;
+    std::vector<Variant<Sword, Magic, Bow>> variants;
+    Population<Unit, Deque<Sword, Magic, Bow>> population;
+    pointers.reserve(n);
+    variants.reserve(n);
+
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        int p = power(rng);
+        switch (kind(rng))
+        {
+        case 0:
+            pointers.push_back(std::make_unique<Virtual<Sword>>(Sword{p}));
+            variants.emplace_back(Sword{p});
+            population.emplace<Sword>(Sword{p});
+            break;
+        case 1:
+            pointers.push_back(std::make_unique<Virtual<Magic>>(Magic{p}));
+            variants.emplace_back(Magic{p});
+            population.emplace<Magic>(Magic{p});
+            break;
+        default:
+            pointers.push_back(std::make_unique<Virtual<Bow>>(Bow{p}));
+            variants.emplace_back(Bow{p});
+            population.emplace<Bow>(Bow{p});
+            break;
+        }
+    }
+
+    volatile std::int64_t sink = 0;
+
+    double virtual_ms = time_ms([&]
+    {
+        std::int64_t total = 0;
+        for (const auto& unit : pointers)
+            total += unit->attack();
+        sink = total;
+    }, 5);
+    std::int64_t expected = sink;
+
+    double variant_ms = time_ms([&]
+    {
+        std::int64_t total = 0;
+        for (const auto& unit : variants)
+            total += unit.visit([](const auto& u) { return u.attack(); });
+        sink = total;
+    }, 5);
+    bool variant_ok = sink == expected;
+
+    double population_ms = time_ms([&]
+    {
+        std::int64_t total = 0;
+        population.for_each([&](const auto& u) { total += u.attack(); });
+        sink = total;
+    }, 5);
+    bool population_ok = sink == expected;
+
+    std::printf("entities: %zu\n", n);
+    std::printf("unique_ptr + virtual: %7.2f ms\n", virtual_ms);
+    std::printf("Variant + visit:      %7.2f ms%s\n", variant_ms, variant_ok ? "" : " (MISMATCH)");
+    std::printf("Population buckets:   %7.2f ms%s\n", population_ms, population_ok ? "" : " (MISMATCH)");
+}
@@ -0,0 +1,111 @@
+// Пропускная способность сложения, умножения и сравнения дробей:
+// task0602::Rational (int, std::gcd после каждой операции) против
+// Rational<std::int64_t> и Rational<__int128>; отдельно — std::gcd
+// против двоичного НОД.
+// Сборка из корня репозитория:
+//   g++ -std=c++20 -O2 -I. bench/rational.cpp -o build/rational
+//   build/rational [число пар, по умолчанию 10^6]
+
+#include "06_02/Rational.hpp"
+#include "Rational.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <numeric>
+#include <random>
+#include <vector>
+
+template <typename F>
+static double time_ns(F&& f, std::size_t count, int repeats)
+{
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < repeats; ++i)
+        f();
+    auto stop = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(stop - start).count() / (double(count) * repeats);
+}
+
+static volatile std::int64_t sink;
+
+template <typename R>
+static void run(const char* name, const std::vector<int>& nums, const std::vector<int>& dens)
+{
+    const std::size_t n = nums.size() / 2;
+    std::vector<R> a, b;
+    a.reserve(n);
+    b.reserve(n);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        a.emplace_back(nums[2 * i], dens[2 * i]);
+        b.emplace_back(nums[2 * i + 1], dens[2 * i + 1]);
+    }
+    std::vector<R> out(n);
+
+    double add = time_ns([&]
+    {
+        for (std::size_t i = 0; i < n; ++i)
+            out[i] = a[i] + b[i];
+    }, n, 10);
+    double mul = time_ns([&]
+    {
+        for (std::size_t i = 0; i < n; ++i)
+            out[i] = a[i] * b[i];
+    }, n, 10);
+    double cmp = time_ns([&]
+    {
+        std::int64_t less = 0;
+        for (std::size_t i = 0; i < n; ++i)
+            if constexpr (requires { a[i] < b[i]; })
+                less += a[i] < b[i];
+            else
+                less += a[i] != b[i];
+        sink = less;
+    }, n, 10);
+
+    std::printf("%-22s add %6.1f   mul %6.1f   cmp %6.1f  ns/op\n", name, add, mul, cmp);
+}
+
+int main(int argc, char** argv)
+{
+    std::size_t n = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 1000000;
+
+    std::mt19937 rng(42);
+    std::uniform_int_distribution<int> num(-30000, 30000), den(1, 30000);
+    std::vector<int> nums(2 * n), dens(2 * n);
+    for (std::size_t i = 0; i < 2 * n; ++i)
+    {
+        nums[i] = num(rng);
+        dens[i] = den(rng);
+    }
+
+    std::printf("pairs: %zu (task0602 has no <, its cmp is !=)\n", n);
+    run<task0602::Rational>("task0602 (int)", nums, dens);
+    run<Rational<std::int64_t>>("Rational<int64_t>", nums, dens);
+    run<Rational<__int128>>("Rational<__int128>", nums, dens);
+
+    std::vector<std::uint64_t> x(n), y(n);
+    std::mt19937_64 wide(7);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        x[i] = wide() >> 1;
+        y[i] = wide() >> 1;
+    }
+    double std_gcd = time_ns([&]
+    {
+        std::uint64_t s = 0;
+        for (std::size_t i = 0; i < n; ++i)
+            s += std::gcd(x[i], y[i]);
+        sink = std::int64_t(s);
+    }, n, 3);
+    double stein = time_ns([&]
+    {
+        std::uint64_t s = 0;
+        for (std::size_t i = 0; i < n; ++i)
+            s += rational_detail::binary_gcd(x[i], y[i]);
+        sink = std::int64_t(s);
+    }, n, 3);
+    std::printf("gcd of 63-bit values: std::gcd %.1f ns, binary %.1f ns\n", std_gcd, stein);
+}
@@ -0,0 +1,97 @@
+// Поэлементные операции над столбцами дробей: цикл по
+// std::vector<task0602::Rational> и std::vector<Rational<std::int32_t>>
+// против пакетных add/mul/compare/to_double над RationalColumn<std::int32_t>;
+// отдельно — перевод vector <-> столбец.
+// Сборка из корня репозитория:
+//   g++ -std=c++20 -O2 -I. bench/rational_column.cpp -o build/rational_column
+//   g++ -std=c++20 -O2 -march=native -I. bench/rational_column.cpp -o build/rational_column_native
+//   build/rational_column [длина столбца, по умолчанию 10^6]
+
+#include "06_02/Rational.hpp"
+#include "RationalColumn.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+template <typename F>
+static double time_ns(F&& f, std::size_t count, int repeats)
+{
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < repeats; ++i)
+        f();
+    auto stop = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(stop - start).count() / (double(count) * repeats);
+}
+
+static volatile std::int64_t sink;
+
+int main(int argc, char** argv)
+{
+    using R = Rational<std::int32_t>;
+
+    std::size_t n = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 1000000;
+
+    std::mt19937 rng(42);
+    std::uniform_int_distribution<int> num(-30000, 30000), den(1, 30000);
+    std::vector<task0602::Rational> old_a, old_b, old_out(n);
+    std::vector<R> a, b, out(n);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        const int an = num(rng), ad = den(rng), bn = num(rng), bd = den(rng);
+        old_a.emplace_back(an, ad);
+        old_b.emplace_back(bn, bd);
+        a.emplace_back(an, ad);
+        b.emplace_back(bn, bd);
+    }
+
+    const double old_add = time_ns([&] { for (std::size_t i = 0; i < n; ++i) old_out[i] = old_a[i] + old_b[i]; }, n, 5);
+    const double old_mul = time_ns([&] { for (std::size_t i = 0; i < n; ++i) old_out[i] = old_a[i] * old_b[i]; }, n, 5);
+    const double old_cmp = time_ns([&]
+    {
+        std::int64_t equal = 0;
+        for (std::size_t i = 0; i < n; ++i)
+            equal += old_a[i] == old_b[i];
+        sink = equal;
+    }, n, 5);
+
+    const double aos_add = time_ns([&] { for (std::size_t i = 0; i < n; ++i) out[i] = a[i] + b[i]; }, n, 5);
+    const double aos_mul = time_ns([&] { for (std::size_t i = 0; i < n; ++i) out[i] = a[i] * b[i]; }, n, 5);
+    const double aos_cmp = time_ns([&]
+    {
+        std::int64_t less = 0;
+        for (std::size_t i = 0; i < n; ++i)
+            less += a[i] < b[i];
+        sink = less;
+    }, n, 5);
+    std::vector<double> approx(n);
+    const double aos_dbl = time_ns([&] { for (std::size_t i = 0; i < n; ++i) approx[i] = double(a[i]); }, n, 5);
+
+    RationalColumn<std::int32_t> ca, cb, cout;
+    const double to_column = time_ns([&] { ca.assign(a); }, n, 5);
+    cb.assign(b);
+    std::vector<R> back;
+    const double to_vector = time_ns([&] { back = ca.to_vector(); }, n, 5);
+
+    std::vector<std::int8_t> order(n);
+    const double soa_add = time_ns([&] { add(ca, cb, cout); }, n, 5);
+    const double soa_mul = time_ns([&] { mul(ca, cb, cout); }, n, 5);
+    const double soa_cmp = time_ns([&] { compare(ca, cb, order); }, n, 5);
+    const double soa_dbl = time_ns([&] { to_double(ca, approx); }, n, 5);
+
+    add(ca, cb, cout);
+    for (std::size_t i = 0; i < n; ++i)
+        if (cout[i] != a[i] + b[i])
+            std::printf("MISMATCH at %zu\n", i);
+
+    std::printf("elements: %zu, ns/element\n", n);
+    std::printf("                          add      mul      cmp   double\n");
+    std::printf("  task0602 (AoS)      %8.1f %8.1f %8.1f (== only)\n", old_add, old_mul, old_cmp);
+    std::printf("  Rational<int32>     %8.1f %8.1f %8.1f %8.1f\n", aos_add, aos_mul, aos_cmp, aos_dbl);
+    std::printf("  RationalColumn      %8.1f %8.1f %8.1f %8.1f\n", soa_add, soa_mul, soa_cmp, soa_dbl);
+    std::printf("  vector -> column %.1f, column -> vector %.1f\n", to_column, to_vector);
+}
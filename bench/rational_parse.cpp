@@ -0,0 +1,122 @@
+// Разбор и запись текста дробей "a/b": operator>> у task0602::Rational и
+// Rational<std::int64_t> через std::istringstream против from_chars по
+// буферу, parse_column и load_column (mmap файла); запись — operator<<
+// в std::ostringstream против to_chars.
+// Сборка из корня репозитория:
+//   g++ -std=c++20 -O2 -I. bench/rational_parse.cpp -o build/rational_parse
+//   build/rational_parse [число дробей, по умолчанию 10^7]
+
+#include "06_02/Rational.hpp"
+#include "RationalText.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+template <typename F>
+static double time_ms(F&& f)
+{
+    auto start = std::chrono::steady_clock::now();
+    f();
+    auto stop = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(stop - start).count();
+}
+
+int main(int argc, char** argv)
+{
+    using R = Rational<std::int64_t>;
+
+    std::size_t n = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 10000000;
+
+    std::mt19937 rng(42);
+    std::uniform_int_distribution<int> num(-1000000, 1000000), den(1, 1000000);
+    std::string text;
+    text.reserve(n * 16);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        text += std::to_string(num(rng));
+        text += '/';
+        text += std::to_string(den(rng));
+        text += i % 8 == 7 ? '\n' : ' ';
+    }
+    std::printf("fractions: %zu, text: %.1f MB, ms\n", n, text.size() / 1e6);
+
+    std::vector<task0602::Rational> old_values(n);
+    const double old_ms = time_ms([&]
+    {
+        std::istringstream in(text);
+        for (auto& value : old_values)
+            in >> value;
+    });
+
+    std::vector<R> stream_values(n);
+    const double stream_ms = time_ms([&]
+    {
+        std::istringstream in(text);
+        for (auto& value : stream_values)
+            in >> value;
+    });
+
+    std::vector<R> chars_values(n);
+    const double chars_ms = time_ms([&]
+    {
+        const char* p = text.data();
+        const char* last = p + text.size();
+        for (auto& value : chars_values)
+            p = from_chars(p, last, value).ptr + 1;
+    });
+
+    RationalColumn<std::int64_t> column;
+    const double column_ms = time_ms([&] { parse_column(text.data(), text.data() + text.size(), column); });
+
+    const char* path = "build/rational_parse.txt";
+    if (std::FILE* file = std::fopen(path, "wb"))
+    {
+        std::fwrite(text.data(), 1, text.size(), file);
+        std::fclose(file);
+    }
+    RationalColumn<std::int64_t> loaded;
+    std::errc load_error{};
+    const double load_ms = time_ms([&] { load_error = load_column(path, loaded); });
+    std::remove(path);
+
+    const bool same = stream_values == chars_values && column.to_vector() == chars_values &&
+                      load_error == std::errc{} && loaded.size() == n;
+    std::printf("  parse  task0602 >>         %8.1f\n", old_ms);
+    std::printf("         Rational<int64> >>  %8.1f\n", stream_ms);
+    std::printf("         from_chars          %8.1f  (%.1fx)\n", chars_ms, stream_ms / chars_ms);
+    std::printf("         parse_column        %8.1f\n", column_ms);
+    std::printf("         load_column (mmap)  %8.1f  %s\n", load_ms, same ? "" : "MISMATCH");
+
+    std::string out_stream;
+    const double write_stream_ms = time_ms([&]
+    {
+        std::ostringstream out;
+        for (const auto& value : chars_values)
+            out << value << ' ';
+        out_stream = out.str();
+    });
+
+    std::string out_chars(n * 24, '\0');
+    const double write_chars_ms = time_ms([&]
+    {
+        char* p = out_chars.data();
+        char* last = p + out_chars.size();
+        for (const auto& value : chars_values)
+        {
+            p = to_chars(p, last, value).ptr;
+            *p++ = ' ';
+        }
+        out_chars.resize(p - out_chars.data());
+    });
+
+    std::printf("  write  Rational<int64> <<  %8.1f\n", write_stream_ms);
+    std::printf("         to_chars            %8.1f  (%.1fx)  %s\n", write_chars_ms, write_stream_ms / write_chars_ms,
+                out_stream == out_chars ? "" : "MISMATCH");
+}
@@ -0,0 +1,90 @@
+// Сумма большого массива дробей: цикл operator+= у task0602::Rational
+// (lcm и reduce() на каждом шаге) и у Rational<std::int64_t> (gcd
+// знаменателей) против RationalSum с отложенным сокращением и попарной
+// sum(span). Знаменатели — делители 360, числители в [-100, 100]: так
+// сумма остаётся в int даже у task0602. Отдельно — гармонический ряд
+// в BigRational.
+// Сборка из корня репозитория:
+//   g++ -std=c++20 -O2 -I. bench/rational_sum.cpp -o build/rational_sum
+//   build/rational_sum [число дробей, по умолчанию 10^7]
+
+#include "06_02/Rational.hpp"
+#include "BigRational.hpp"
+#include "RationalSum.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+template <typename F>
+static double time_ms(F&& f)
+{
+    auto start = std::chrono::steady_clock::now();
+    f();
+    auto stop = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(stop - start).count();
+}
+
+int main(int argc, char** argv)
+{
+    using R = Rational<std::int64_t>;
+
+    std::size_t n = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 10000000;
+
+    std::mt19937 rng(42);
+    const int dens[] = {1, 2, 3, 4, 5, 6, 8, 9, 10, 12, 15, 18, 20, 24, 30, 36, 40, 45, 60, 72, 90, 120, 180, 360};
+    std::vector<task0602::Rational> old_values;
+    std::vector<R> values;
+    old_values.reserve(n);
+    values.reserve(n);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        const int num = int(rng() % 201) - 100, den = dens[rng() % std::size(dens)];
+        old_values.emplace_back(num, den);
+        values.emplace_back(num, den);
+    }
+
+    task0602::Rational old_total;
+    const double old_ms = time_ms([&] { for (const auto& v : old_values) old_total += v; });
+
+    R plain;
+    const double plain_ms = time_ms([&] { for (const R& v : values) plain += v; });
+
+    R lazy;
+    const double lazy_ms = time_ms([&]
+    {
+        RationalSum<std::int64_t> acc;
+        for (const R& v : values)
+            acc += v;
+        lazy = acc.value();
+    });
+
+    R pairwise;
+    const double pairwise_ms = time_ms([&] { pairwise = sum(values); });
+
+    std::printf("fractions: %zu, sum = %lld/%lld\n", n, (long long)plain.numerator(), (long long)plain.denominator());
+    const bool old_ok = old_total == task0602::Rational(int(plain.numerator()), int(plain.denominator()));
+    std::printf("  task0602 +=         %8.1f ms  %s\n", old_ms, old_ok ? "" : "MISMATCH");
+    std::printf("  Rational<int64> +=  %8.1f ms\n", plain_ms);
+    std::printf("  RationalSum         %8.1f ms  %s\n", lazy_ms, lazy == plain ? "" : "MISMATCH");
+    std::printf("  sum(span)           %8.1f ms  %s\n", pairwise_ms, pairwise == plain ? "" : "MISMATCH");
+    std::printf("  speedup over task0602: %.1fx lazy, %.1fx pairwise\n", old_ms / lazy_ms, old_ms / pairwise_ms);
+
+    // Гармонический ряд: попарно складываются числа одного размера.
+    for (int terms : {2000, 8000})
+    {
+        std::vector<BigRational> h;
+        for (int k = 1; k <= terms; ++k)
+            h.emplace_back(1, k);
+
+        BigRational sequential, tree;
+        const double seq_ms = time_ms([&] { for (const auto& v : h) sequential += v; });
+        const double tree_ms = time_ms([&] { tree = sum(h); });
+        std::printf("H(%d): += %8.1f ms, sum(span) %8.1f ms  %s\n", terms, seq_ms, tree_ms,
+                    sequential == tree ? "" : "MISMATCH");
+    }
+}
@@ -0,0 +1,754 @@
+// Набор микробенчмарков по всем компонентам с порогом регрессий:
+//   sort/<распределение>/<n>    — quickSort (Sort.hpp);
+//   vector/...                  — Vector::push_back с reserve и без, копия;
+//   tuple/get                   — Tuple::get всех четырёх полей;
+//   rational/...                — сложение, умножение, сравнение Rational;
+//   decorator/...               — Decorator::name из кэша и с построением,
+//                                 StaticDecorator::name;
+//   unit_group/...              — UnitGroup::attack и collectAttacks.
+//
+// Случай — прогон (run) на ops операций; подготовка (prepare) перед каждым
+// прогоном не замеряется. Скорость виртуальной машины плавает в полтора
+// раза, поэтому случай замеряется вперемежку с опорным ядром — std::sort
+// 1024 новых чисел: замер — прогоны случая примерно на время прогона ядра
+// между двумя прогонами ядра, и в зачёт идёт отношение их времён. Когда
+// машина занята, разные случаи замедляются по-разному и отношение уже
+// плывёт, поэтому в сравнение идут только тихие замеры — оба прогона ядра
+// не дольше уровня тихой машины больше чем на 15%. Занятость тянется
+// десятками секунд, и случаи замеряются по кругу короткими отрезками, пока
+// у каждого не наберётся --time секунд и 30 тихих замеров (не дольше пяти
+// минут). В таблице — медиана и p99 прогона на операцию по всем замерам и
+// медиана опорного ядра. Процесс закрепляется за одним ядром; вывод
+// std::cout (его пишут Vector и UnitGroup::attack) отбрасывается.
+//
+// --json сохраняет результаты: уровень тихой машины (5-й процентиль
+// прогонов ядра за не меньше чем минуту кругов) и распределение отношений
+// (до 256 порядковых статистик). Тот же файл, переданный в --baseline,
+// становится эталоном: замеры берутся при его уровне тихой машины, и
+// регрессия — отношения случая стохастически больше эталонных, умноженных
+// на 1 + --threshold: односторонний критерий Манна — Уитни на уровне
+// значимости 0.001. Коды возврата: 1 — есть регрессия; 2 — в эталоне нет
+// результатов, строка не разбирается или у случая меньше 10 тихих замеров
+// (машина всё время была занята, судить не по чему).
+//
+// p99 осмыслен от 100 прогонов; у медленных случаев их меньше, и вместо
+// p99 выводится максимум (в таблице — со звёздочкой, в JSON — max_ns).
+//
+// Эталон bench/baseline.json снят на одной машине в Release (цели
+// bench_baseline и bench_check); на другой машине его надо снять заново.
+//
+// Сборка из корня репозитория:
+//   g++ -std=c++20 -O2 -pthread -I. bench/suite.cpp -o build/suite
+//   build/suite [--filter подстрока] [--cpu ядро, -1 — без закрепления]
+//               [--time с на случай, 0.5] [--json файл] [--baseline файл]
+//               [--threshold доля, 0.2]
+
+#include "Entity.hpp"
+#include "GameUnit.hpp"
+#include "Rational.hpp"
+#include "Sort.hpp"
+#include "Tuple.hpp"
+#include "Vector.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <random>
+#include <streambuf>
+#include <string>
+#include <vector>
+
+#ifdef __linux__
+#include <sched.h>
+#endif
+
+// Значение считается использованным: компилятор не выбросит вычисление.
+template <typename T>
+static void keep(const T& value)
+{
+    asm volatile("" : : "r,m"(value) : "memory");
+}
+
+// Квантиль q отсортированной выборки; медиана чётной — среднее двух.
+static double quantile(const std::vector<double>& sorted, double q)
+{
+    const std::size_t n = sorted.size();
+    if (q == 0.5)
+        return n % 2 ? sorted[n / 2] : (sorted[n / 2 - 1] + sorted[n / 2]) / 2;
+    return sorted[std::min(n - 1, std::size_t(std::ceil(q * double(n))) - 1)];
+}
+
+struct Case
+{
+    std::string name;
+    std::size_t ops;
+    std::function<void()> run;
+    std::function<void()> prepare = [] {};
+};
+
+struct Result
+{
+    std::string name;
+    std::size_t samples = 0;      // прогонов случая
+    double median_ns = 0;
+    double p99_ns = 0;
+    double reference_ns = 0;      // медиана опорного ядра
+    std::vector<double> ratios;   // отношения к опорному ядру тихих замеров, по возрастанию
+
+    bool has_p99() const { return samples >= 100; }
+
+    // Меньше 10 тихих замеров — машина была занята, судить не по чему.
+    bool judged() const { return ratios.size() >= 10; }
+
+    double relative() const { return quantile(ratios, 0.5); }
+};
+
+struct Options
+{
+    const char* filter = "";
+    int cpu = -2;           // -2 — текущее ядро, -1 — без закрепления
+    double seconds = 0.5;
+    const char* json = nullptr;
+    const char* baseline = nullptr;
+    double threshold = 0.2;
+};
+
+// Приёмник для std::cout: буфер переписывается по кругу.
+class NullBuffer : public std::streambuf
+{
+public:
+    NullBuffer() { setp(m_buffer, m_buffer + sizeof(m_buffer)); }
+
+protected:
+    int overflow(int c) override
+    {
+        setp(m_buffer, m_buffer + sizeof(m_buffer));
+        return c;
+    }
+
+private:
+    char m_buffer[4096];
+};
+
+//////////////////////////////////////////////////////////////////
+
+static double time_ns(const Case& c)
+{
+    using clock = std::chrono::steady_clock;
+    c.prepare();
+    const auto start = clock::now();
+    c.run();
+    const auto stop = clock::now();
+    return std::chrono::duration<double, std::nano>(stop - start).count() / double(c.ops);
+}
+
+// Прогон опорного ядра тихий, если дольше уровня тихой машины не больше
+// чем на эту долю. Замер тихий, если тихи прогоны ядра и до, и после
+// него: в занятом состоянии машины разные случаи замедляются по-разному,
+// и опорное ядро их уже не выравнивает.
+constexpr double quiet_margin = 1.15;
+
+// Замер: худший из двух соседних прогонов ядра и отношение к их среднему.
+struct Measurement
+{
+    double reference;
+    double ratio;
+};
+
+// Замеры случая, накопленные за круги.
+struct Progress
+{
+    const Case* c = nullptr;
+    std::size_t runs = 0;          // прогонов случая на замер; 0 — ещё не прогрет
+    double seconds = 0;            // время замеров
+    std::vector<double> times;     // прогоны случая, нс на операцию
+    std::vector<double> references;
+    std::vector<Measurement> measurements;
+};
+
+constexpr std::size_t max_measurements = 100000;
+
+// Отрезок замеров случая длиной slice секунд, но не меньше одного замера.
+static void measure(Progress& p, const Case& reference, double slice)
+{
+    using clock = std::chrono::steady_clock;
+    const Case& c = *p.c;
+
+    // Первый раз — сколько прогонов случая идёт на один прогон ядра, по
+    // лучшим из трёх.
+    if (!p.runs)
+    {
+        double case_best = 0, reference_best = 0;
+        for (int i = 0; i < 3; ++i)
+        {
+            const double r = time_ns(reference) * double(reference.ops);
+            const double x = time_ns(c) * double(c.ops);
+            reference_best = i == 0 ? r : std::min(reference_best, r);
+            case_best = i == 0 ? x : std::min(case_best, x);
+        }
+        p.runs = std::max<std::size_t>(1, std::size_t(reference_best / case_best));
+    }
+
+    // Прогрев после других случаев.
+    c.prepare();
+    c.run();
+
+    const auto start = clock::now();
+    double before = time_ns(reference);
+    p.references.push_back(before);
+    do
+    {
+        double sum = 0;
+        for (std::size_t i = 0; i < p.runs; ++i)
+        {
+            const double t = time_ns(c);
+            sum += t;
+            if (p.times.size() < max_measurements)
+                p.times.push_back(t);
+        }
+        const double after = time_ns(reference);
+        p.references.push_back(after);
+        p.measurements.push_back({std::max(before, after), sum / double(p.runs) / ((before + after) / 2)});
+        before = after;
+    } while (clock::now() < start + std::chrono::duration<double>(slice)
+             && p.measurements.size() < max_measurements);
+    p.seconds += std::chrono::duration<double>(clock::now() - start).count();
+}
+
+static std::size_t quiet_count(const Progress& p, double quiet_ns)
+{
+    return std::size_t(std::count_if(p.measurements.begin(), p.measurements.end(),
+                                     [&](const Measurement& m) { return m.reference <= quiet_ns * quiet_margin; }));
+}
+
+// Итог случая: время по всем прогонам, отношения — по тихим замерам.
+static Result summarize(const Progress& p, double quiet_ns)
+{
+    Result r;
+    r.name = p.c->name;
+    std::vector<double> times(p.times), references(p.references);
+    std::sort(times.begin(), times.end());
+    std::sort(references.begin(), references.end());
+    r.samples = times.size();
+    r.median_ns = quantile(times, 0.5);
+    r.p99_ns = quantile(times, 0.99);
+    r.reference_ns = quantile(references, 0.5);
+    for (const Measurement& m : p.measurements)
+        if (m.reference <= quiet_ns * quiet_margin)
+            r.ratios.push_back(m.ratio);
+    std::sort(r.ratios.begin(), r.ratios.end());
+    return r;
+}
+
+// Уровень тихой машины по всем прогонам ядра — 5-й процентиль.
+static double quiet_level(const std::vector<Progress>& progress)
+{
+    std::vector<double> all;
+    for (const Progress& p : progress)
+        all.insert(all.end(), p.references.begin(), p.references.end());
+    auto nth = all.begin() + std::ptrdiff_t(all.size() / 20);
+    std::nth_element(all.begin(), nth, all.end());
+    return *nth;
+}
+
+// Односторонний критерий Манна — Уитни: p-значение гипотезы «x не больше
+// y, умноженного на scale» против «x больше». Обе выборки отсортированы;
+// нормальное приближение, совпадения идут за половину пары.
+static double rank_test(const std::vector<double>& x, const std::vector<double>& y, double scale)
+{
+    std::vector<double> scaled(y);
+    for (double& v : scaled)
+        v *= scale;
+    double u = 0;
+    for (double v : x)
+    {
+        const auto [low, high] = std::equal_range(scaled.begin(), scaled.end(), v);
+        u += double(low - scaled.begin()) + double(high - low) / 2;
+    }
+    const double n = double(x.size()), m = double(y.size());
+    const double z = (u - n * m / 2) / std::sqrt(n * m * (n + m + 1) / 12);
+    return std::erfc(z / std::sqrt(2.0)) / 2;
+}
+
+static void pin(int cpu)
+{
+#ifdef __linux__
+    if (cpu == -2)
+        cpu = sched_getcpu();
+    if (cpu < 0)
+        return;
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    if (sched_setaffinity(0, sizeof(set), &set) != 0)
+        std::fprintf(stderr, "suite: cannot pin to CPU %d\n", cpu);
+    else
+        std::printf("pinned to CPU %d\n", cpu);
+#else
+    (void)cpu;
+#endif
+}
+
+//////////////////////////////////////////////////////////////////
+// Случаи. Данные живут до конца main: случаи держат их в shared_ptr.
+
+// Опорное ядро сортирует каждый раз новые числа: одни и те же предсказатель
+// переходов заучивает, и время прогона зависело бы от того, что шло перед ним.
+static Case make_reference()
+{
+    constexpr std::size_t n = 1024;
+    auto rng = std::make_shared<std::mt19937>(7);
+    auto work = std::make_shared<std::vector<int>>(n);
+    return {"reference", n, [work] { std::sort(work->begin(), work->end()); keep(work->front()); },
+            [work, rng]
+            {
+                for (int& x : *work)
+                    x = int((*rng)());
+            }};
+}
+
+static void add_sort(std::vector<Case>& cases)
+{
+    for (std::size_t n : {1000, 10000})
+    {
+        std::mt19937 rng(42);
+        std::vector<int> random(n), sorted(n), reversed(n), few(n);
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            random[i] = int(rng());
+            sorted[i] = int(i);
+            reversed[i] = int(n - i);
+            few[i] = int(rng() % 16);
+        }
+
+        const std::pair<const char*, std::vector<int>*> inputs[] = {
+            {"random", &random}, {"sorted", &sorted}, {"reversed", &reversed}, {"few_unique", &few}};
+        for (const auto& [name, input] : inputs)
+        {
+            auto source = std::make_shared<std::vector<int>>(*input);
+            auto work = std::make_shared<std::vector<int>>(n);
+            cases.push_back({"sort/" + std::string(name) + "/" + std::to_string(n), n,
+                             [work] { quickSort(*work, 0, int(work->size()) - 1); keep(work->front()); },
+                             [work, source] { *work = *source; }});
+        }
+    }
+}
+
+static void add_vector(std::vector<Case>& cases)
+{
+    constexpr std::size_t n = 10000;
+
+    cases.push_back({"vector/push_back/10000", n, []
+    {
+        Vector<int> v;
+        for (std::size_t i = 0; i < n; ++i)
+            v.push_back(int(i));
+        keep(v.size());
+    }});
+
+    cases.push_back({"vector/push_back_reserved/10000", n, []
+    {
+        Vector<int> v;
+        v.reserve(n);
+        for (std::size_t i = 0; i < n; ++i)
+            v.push_back(int(i));
+        keep(v.size());
+    }});
+
+    auto source = std::make_shared<Vector<int>>();
+    for (std::size_t i = 0; i < n; ++i)
+        source->push_back(int(i));
+    cases.push_back({"vector/copy/10000", n, [source]
+    {
+        Vector<int> copy(*source);
+        keep(copy.size());
+    }});
+}
+
+static void add_tuple(std::vector<Case>& cases)
+{
+    using T = Tuple<char, int, double, short>;
+    auto tuples = std::make_shared<std::vector<T>>();
+    for (int i = 0; i < 4096; ++i)
+        tuples->emplace_back(char(i), int(i), double(i), short(i));
+
+    cases.push_back({"tuple/get", tuples->size(), [tuples]
+    {
+        double sum = 0;
+        for (const T& t : *tuples)
+            sum += t.get<0>() + t.get<1>() + t.get<2>() + t.get<3>();
+        keep(sum);
+    }});
+}
+
+static void add_rational(std::vector<Case>& cases)
+{
+    using R = Rational<std::int64_t>;
+    constexpr std::size_t n = 4096;
+
+    std::mt19937 rng(42);
+    std::uniform_int_distribution<int> num(-1000, 1000), den(1, 1000);
+    auto a = std::make_shared<std::vector<R>>();
+    auto b = std::make_shared<std::vector<R>>();
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        a->emplace_back(num(rng), den(rng));
+        b->emplace_back(num(rng), den(rng));
+    }
+    auto out = std::make_shared<std::vector<R>>(n);
+
+    cases.push_back({"rational/add", n, [a, b, out]
+    {
+        for (std::size_t i = 0; i < n; ++i)
+            (*out)[i] = (*a)[i] + (*b)[i];
+        keep(out->back());
+    }});
+
+    cases.push_back({"rational/mul", n, [a, b, out]
+    {
+        for (std::size_t i = 0; i < n; ++i)
+            (*out)[i] = (*a)[i] * (*b)[i];
+        keep(out->back());
+    }});
+
+    cases.push_back({"rational/compare", n, [a, b]
+    {
+        std::size_t less = 0;
+        for (std::size_t i = 0; i < n; ++i)
+            less += (*a)[i] < (*b)[i];
+        keep(less);
+    }});
+}
+
+static void add_decorator(std::vector<Case>& cases)
+{
+    using Dynamic = Decorator<Decorator<BaseEntity>>;
+    using Static = StaticDecorator<StaticDecorator<StaticEntity>>;
+    constexpr std::size_t n = 1024;
+
+    auto entities = std::make_shared<std::vector<std::unique_ptr<Dynamic>>>();
+    for (std::size_t i = 0; i < n; ++i)
+        entities->push_back(std::make_unique<Dynamic>("Entity" + std::to_string(i), int(i)));
+
+    cases.push_back({"decorator/name_cached", n, [entities]
+    {
+        std::size_t length = 0;
+        for (const auto& e : *entities)
+            length += e->name().size();
+        keep(length);
+    }});
+
+    // rename() сбрасывает кэш: name() строит строку заново.
+    cases.push_back({"decorator/name_rebuild", n, [entities]
+    {
+        std::size_t length = 0;
+        for (const auto& e : *entities)
+            length += e->name().size();
+        keep(length);
+    }, [entities]
+    {
+        for (std::size_t i = 0; i < n; ++i)
+            (*entities)[i]->rename("Entity" + std::to_string(i));
+    }});
+
+    auto statics = std::make_shared<std::vector<Static>>();
+    for (std::size_t i = 0; i < n; ++i)
+        statics->emplace_back("Entity" + std::to_string(i), int(i));
+
+    cases.push_back({"decorator/static_name", n, [statics]
+    {
+        std::size_t length = 0;
+        for (const Static& e : *statics)
+            length += e.name().size();
+        keep(length);
+    }});
+}
+
+// Армия из n юнитов: отряды по 64 юнита, по 16 отрядов в роте и т. д.
+static GameUnitPtr make_army(std::size_t n, std::size_t& next)
+{
+    auto group = std::make_shared<UnitGroup>();
+    if (n <= 64)
+    {
+        for (std::size_t i = 0; i < n; ++i, ++next)
+            group->addUnit(std::make_shared<SingleUnit>(
+                CharacterBuilder().setName("Unit" + std::to_string(next % 100)).setAttack(int(next % 50)).build()));
+        return group;
+    }
+
+    const std::size_t part = (n + 15) / 16;
+    for (std::size_t done = 0; done < n; done += part)
+        group->addUnit(make_army(std::min(part, n - done), next));
+    return group;
+}
+
+static void add_unit_group(std::vector<Case>& cases)
+{
+    for (std::size_t n : {1000, 100000})
+    {
+        std::size_t next = 0;
+        GameUnitPtr army = make_army(n, next);
+        auto events = std::make_shared<std::vector<AttackEvent>>(n);
+
+        cases.push_back({"unit_group/attack/" + std::to_string(n), n, [army] { army->attack(); }});
+        cases.push_back({"unit_group/collect/" + std::to_string(n), n, [army, events]
+        {
+            keep(army->collectAttacks(events->data()));
+        }});
+    }
+}
+
+//////////////////////////////////////////////////////////////////
+// JSON: по результату на строку — --baseline читает свой же формат.
+// Распределение отношений — не больше 256 порядковых статистик.
+
+static void write_json(const char* path, double quiet_ns, const std::vector<Result>& results)
+{
+    std::FILE* f = std::fopen(path, "w");
+    if (!f)
+    {
+        std::fprintf(stderr, "suite: cannot write %s\n", path);
+        std::exit(2);
+    }
+    std::fprintf(f, "{\"unit\": \"ns/op\", \"quiet_reference_ns\": %.3f, \"results\": [\n", quiet_ns);
+    for (std::size_t i = 0; i < results.size(); ++i)
+    {
+        const Result& r = results[i];
+        std::fprintf(f, "{\"name\": \"%s\", \"samples\": %zu, \"median_ns\": %.3f, \"reference_ns\": %.3f, "
+                        "\"%s\": %.3f, \"ratios\": [",
+                     r.name.c_str(), r.samples, r.median_ns, r.reference_ns, r.has_p99() ? "p99_ns" : "max_ns",
+                     r.p99_ns);
+        const std::size_t n = r.ratios.size(), m = std::min<std::size_t>(n, 256);
+        for (std::size_t j = 0; j < m; ++j)
+            std::fprintf(f, "%s%.6g", j ? ", " : "", r.ratios[m > 1 ? j * (n - 1) / (m - 1) : 0]);
+        std::fprintf(f, "]}%s\n", i + 1 < results.size() ? "," : "");
+    }
+    std::fprintf(f, "]}\n");
+    std::fclose(f);
+}
+
+// Строка результата; false — строка не в формате write_json.
+static bool parse_result(const char* line, Result& r)
+{
+    char name[256];
+    int offset = 0;
+    if (std::sscanf(line, "{\"name\": \"%255[^\"]\", \"samples\": %zu, \"median_ns\": %lf, \"reference_ns\": %lf, "
+                          "\"%*[a-z0-9]_ns\": %lf, \"ratios\": [%n",
+                    name, &r.samples, &r.median_ns, &r.reference_ns, &r.p99_ns, &offset) != 5 || !offset)
+        return false;
+    r.name = name;
+    r.ratios.clear();
+    for (const char* p = line + offset;; ++p)
+    {
+        char* end;
+        const double v = std::strtod(p, &end);
+        if (end == p || !(v > 0))
+            return false;
+        r.ratios.push_back(v);
+        p = end;
+        if (*p == ']')
+            break;
+        if (*p != ',')
+            return false;
+    }
+    std::sort(r.ratios.begin(), r.ratios.end());
+    return true;
+}
+
+static std::map<std::string, Result> read_json(const char* path, double& quiet_ns)
+{
+    std::FILE* f = std::fopen(path, "r");
+    if (!f)
+    {
+        std::fprintf(stderr, "suite: cannot read %s\n", path);
+        std::exit(2);
+    }
+    std::map<std::string, Result> results;
+    char line[8192];
+    quiet_ns = 0;
+    for (int number = 1; std::fgets(line, sizeof(line), f); ++number)
+    {
+        if (number == 1)
+        {
+            if (std::sscanf(line, "{\"unit\": \"ns/op\", \"quiet_reference_ns\": %lf", &quiet_ns) != 1 ||
+                !(quiet_ns > 0))
+            {
+                std::fprintf(stderr, "suite: %s: no quiet_reference_ns header\n", path);
+                std::exit(2);
+            }
+            continue;
+        }
+        if (!std::strncmp(line, "]}", 2))
+            continue;
+        Result r;
+        if (!parse_result(line, r))
+        {
+            std::fprintf(stderr, "suite: %s:%d: malformed result\n", path, number);
+            std::exit(2);
+        }
+        results[r.name] = std::move(r);
+    }
+    std::fclose(f);
+    if (results.empty())
+    {
+        std::fprintf(stderr, "suite: %s: no results\n", path);
+        std::exit(2);
+    }
+    return results;
+}
+
+//////////////////////////////////////////////////////////////////
+
+int main(int argc, char** argv)
+{
+    Options options;
+    for (int i = 1; i < argc; ++i)
+    {
+        const char* arg = argv[i];
+        const char* value = i + 1 < argc ? argv[i + 1] : nullptr;
+        if (!value)
+        {
+            std::fprintf(stderr, "suite: %s needs a value\n", arg);
+            return 2;
+        }
+        if (!std::strcmp(arg, "--filter"))
+            options.filter = value;
+        else if (!std::strcmp(arg, "--cpu"))
+            options.cpu = std::atoi(value);
+        else if (!std::strcmp(arg, "--time"))
+            options.seconds = std::atof(value);
+        else if (!std::strcmp(arg, "--json"))
+            options.json = value;
+        else if (!std::strcmp(arg, "--baseline"))
+            options.baseline = value;
+        else if (!std::strcmp(arg, "--threshold"))
+            options.threshold = std::atof(value);
+        else
+        {
+            std::fprintf(stderr, "suite: unknown option %s\n", arg);
+            return 2;
+        }
+        ++i;
+    }
+
+    pin(options.cpu);
+
+    NullBuffer null;
+    std::streambuf* const console = std::cout.rdbuf(&null);
+
+    const Case reference = make_reference();
+    std::vector<Case> cases;
+    add_sort(cases);
+    add_vector(cases);
+    add_tuple(cases);
+    add_rational(cases);
+    add_decorator(cases);
+    add_unit_group(cases);
+
+    // Данные случаев размещены до эталона и до замеров: раскладка кучи под
+    // ними одна и та же в любом режиме, а от неё зависит время прогонов.
+    std::map<std::string, Result> baseline;
+    double quiet_ns = 0;
+    if (options.baseline)
+        baseline = read_json(options.baseline, quiet_ns);
+
+    // Случаи замеряются по кругу отрезками по 20 мс: занятость машины
+    // тянется десятками секунд, и тихий промежуток идёт в зачёт всем
+    // случаям сразу. Случай готов, когда на него ушло --time секунд и у него
+    // 30 тихих замеров. Без эталона уровень тихой машины уточняется после
+    // каждого круга, и круги идут не меньше минуты, чтобы в них попало и
+    // тихое время; с эталоном уровень — его. Дольше пяти минут набор не идёт.
+    std::vector<Progress> progress;
+    for (const Case& c : cases)
+        if (c.name.find(options.filter) != std::string::npos)
+        {
+            progress.emplace_back();
+            progress.back().c = &c;
+        }
+
+    using clock = std::chrono::steady_clock;
+    const auto start = clock::now();
+    const double min_seconds = options.baseline ? 0 : 60, max_seconds = 300;
+    double elapsed = 0;
+    for (bool pending = !progress.empty(); pending && elapsed < max_seconds;)
+    {
+        pending = false;
+        for (Progress& p : progress)
+            if (elapsed < min_seconds || p.seconds < options.seconds
+                || (quiet_count(p, quiet_ns) < 30 && p.measurements.size() < max_measurements))
+            {
+                measure(p, reference, 0.02);
+                pending = true;
+            }
+        if (!options.baseline)
+            quiet_ns = quiet_level(progress);
+        elapsed = std::chrono::duration<double>(clock::now() - start).count();
+    }
+
+    // Уровень значимости критерия регрессии.
+    constexpr double significance = 0.001;
+
+    std::printf("quiet reference: %.2f ns%s, %.0f s\n", quiet_ns, options.baseline ? " (baseline)" : "", elapsed);
+    std::printf("%-34s %8s %8s %12s %12s %8s %12s\n", "case", "samples", "quiet", "median ns", "p99 ns", "ref ns",
+                "vs baseline");
+    std::vector<Result> results;
+    int regressions = 0, unjudged = 0;
+    bool few_samples = false;
+    for (const Progress& p : progress)
+    {
+        Result r = summarize(p, quiet_ns);
+
+        char verdict[64] = "";
+        const auto it = baseline.find(r.name);
+        if (!r.judged() || (it != baseline.end() && !it->second.judged()))
+        {
+            ++unjudged;
+            std::snprintf(verdict, sizeof(verdict), "busy");
+        }
+        else if (it != baseline.end())
+        {
+            // Изменение — по медиане отношений; решение — по критерию.
+            const Result& base = it->second;
+            const bool regressed = rank_test(r.ratios, base.ratios, 1 + options.threshold) < significance;
+            regressions += regressed;
+            std::snprintf(verdict, sizeof(verdict), "%+6.1f%%%s", (r.relative() / base.relative() - 1) * 100,
+                          regressed ? " REGRESSION" : "");
+        }
+        else if (options.baseline)
+            std::snprintf(verdict, sizeof(verdict), "new");
+        std::printf("%-34s %8zu %8zu %12.2f %11.2f%c %8.2f %12s\n", r.name.c_str(), r.samples, r.ratios.size(),
+                    r.median_ns, r.p99_ns, r.has_p99() ? ' ' : '*', r.reference_ns, verdict);
+        few_samples |= !r.has_p99();
+        results.push_back(std::move(r));
+    }
+
+    cases.clear();
+    std::cout.rdbuf(console);
+
+    if (few_samples)
+        std::printf("* fewer than 100 samples: maximum, not p99\n");
+
+    if (options.json)
+        write_json(options.json, quiet_ns, results);
+
+    if (regressions)
+    {
+        std::printf("%d regression(s)\n", regressions);
+        return 1;
+    }
+    if (unjudged)
+    {
+        std::printf("%d case(s) not judged: too few quiet samples, the machine was busy\n", unjudged);
+        return 2;
+    }
+    return 0;
+}
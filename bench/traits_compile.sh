@@ -0,0 +1,54 @@
+#!/usr/bin/env bash
+set -e
+
+# Время компиляции TypeTraits.hpp: 10k инстанцирований трейтов
+# со встроенными трейтами компилятора и без них (TYPE_TRAITS_NO_BUILTINS).
+# Запуск из корня репозитория: bash bench/traits_compile.sh [N]
+
+N=${1:-10000}
+CXX=${CXX:-clang++}
+OUT=${OUT:-build/traits_compile}
+mkdir -p "$OUT"
+
+SRC="$OUT/traits_$N.cpp"
+{
+    echo '#include "TypeTraits.hpp"'
+    echo 'template <int> struct Tag {};'
+    i=0
+    while [ $i -lt $((N / 4)) ]; do
+        echo "static_assert(is_same_v<decay_t<const Tag<$i>&>, Tag<$i>>);"
+        echo "static_assert(is_same_v<decay_t<Tag<$i>[2]>, Tag<$i>*>);"
+        echo "static_assert(!is_function_v<Tag<$i>>);"
+        echo "static_assert(is_same_v<remove_cvref_t<volatile Tag<$i>&&>, Tag<$i>>);"
+        i=$((i + 1))
+    done
+} > "$SRC"
+
+TRACE=
+if $CXX --version | grep -q clang; then
+    TRACE=-ftime-trace
+else
+    TRACE=-ftime-report
+fi
+
+for MODE in builtins fallback; do
+    DEFS=
+    [ $MODE = fallback ] && DEFS=-DTYPE_TRAITS_NO_BUILTINS
+    echo "=== $MODE ($N traits) ==="
+    time $CXX -std=c++20 -I. $DEFS $TRACE -c "$SRC" -o "$OUT/traits_$MODE.o" 2> "$OUT/traits_$MODE.report" \
+        || { cat "$OUT/traits_$MODE.report"; exit 1; }
+    if [ "$TRACE" = -ftime-trace ]; then
+        mv "$OUT/traits_$MODE.json" "$OUT/traits_$MODE.trace.json" 2>/dev/null || true
+        # Сводка clang: суммарное время по категориям (InstantiateClass, Frontend, ...)
+        python3 - "$OUT/traits_$MODE.trace.json" <<'PY'
+import json, sys
+events = json.load(open(sys.argv[1]))["traceEvents"]
+for e in events:
+    if e.get("name", "").startswith("Total "):
+        print(f'{e["name"][6:]:<28} {e["dur"] / 1000:10.1f} ms  x{e["args"]["count"]}')
+PY
+    else
+        grep -E "template instantiation|phase parsing|TOTAL" "$OUT/traits_$MODE.report" || true
+    fi
+    echo
+done